@@ -0,0 +1,34 @@
+add_executable(${APP_NAME}-bench ${LIBRARY_SOURCES}
+  bench/main.cpp
+)
+
+target_include_directories(${APP_NAME}-bench PRIVATE
+  ${CMAKE_SOURCE_DIR}/src/include
+  ${sdl3_SOURCE_DIR}/include
+  ${sdl3_image_SOURCE_DIR}/include
+  ${sdl3_net_SOURCE_DIR}/include
+  ${sdl3_ttf_SOURCE_DIR}/include
+  ${libxmp_SOURCE_DIR}/include
+)
+
+if(SDL STREQUAL "STATIC")
+  target_link_libraries(${APP_NAME}-bench
+    nlohmann_json
+    SDL3::SDL3-static
+    SDL3_image::SDL3_image-static
+    SDL3_net::SDL3_net-static
+    SDL3_ttf::SDL3_ttf-static ${FREETYPE_LIBRARIES}
+    vorbisenc vorbisfile vorbis
+    Threads::Threads
+  )
+else()
+  target_link_libraries(${APP_NAME}-bench
+    nlohmann_json
+    SDL3::SDL3
+    SDL3_image::SDL3_image
+    SDL3_net::SDL3_net
+    SDL3_ttf::SDL3_ttf ${FREETYPE_LIBRARIES}
+    vorbisenc vorbisfile vorbis
+    Threads::Threads
+  )
+endif()
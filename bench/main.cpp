@@ -0,0 +1,366 @@
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+#include "audioplayer.h"
+#include "container.h"
+#include "flatselect.h"
+#include "flattext.h"
+#include "fontbook.h"
+#include "mixkernel.h"
+#include "profiler.h"
+#include "window.h"
+
+using json = nlohmann::json;
+
+/**
+ * Headless benchmarks
+ *
+ * Runs with SDL's offscreen (or dummy) video driver, the software
+ * renderer and the dummy audio driver, so it needs no GPU, display or
+ * sound card. Results are written as JSON to stdout, or to the file
+ * given with --output. Use --filter to only run benchmarks whose name
+ * contains a string.
+ */
+
+struct Result {
+  std::string name;
+  size_t iterations;
+  double mean;
+  double median;
+  double min;
+  double max;
+};
+
+static std::vector<Result> results;
+static std::string filter;
+
+// Each benchmark runs for at least this long, after one warm up run
+static const double MIN_TIME = 250.0;
+static const size_t MIN_ITERATIONS = 5;
+static const size_t MAX_ITERATIONS = 100000;
+
+static void benchmark(const std::string& name, const std::function<void()>& setup, const std::function<void()>& run)
+{
+  if (!filter.empty() && name.find(filter) == std::string::npos) {
+    return;
+  }
+
+  setup();
+  run();
+
+  std::vector<double> times;
+  double total = 0.0;
+  while (times.size() < MAX_ITERATIONS && (times.size() < MIN_ITERATIONS || total < MIN_TIME)) {
+    setup();
+    double start = SGI::Profiler::milliseconds();
+    run();
+    double elapsed = SGI::Profiler::milliseconds() - start;
+    times.push_back(elapsed);
+    total += elapsed;
+  }
+
+  std::sort(times.begin(), times.end());
+  Result result;
+  result.name = name;
+  result.iterations = times.size();
+  result.mean = total / times.size();
+  result.median = times[times.size() / 2];
+  result.min = times.front();
+  result.max = times.back();
+  results.push_back(result);
+
+  fprintf(stderr, "%-48s %10.4f ms  (%zu runs)\n", name.c_str(), result.median, result.iterations);
+}
+
+static void benchmark(const std::string& name, const std::function<void()>& run)
+{
+  benchmark(name, [](){}, run);
+}
+
+static bool writeResults(FILE* file)
+{
+  json benchmarks = json::array();
+  for (const Result& result : results) {
+    benchmarks.push_back({
+      {"name", result.name},
+      {"iterations", result.iterations},
+      {"mean", result.mean},
+      {"median", result.median},
+      {"min", result.min},
+      {"max", result.max},
+    });
+  }
+
+  json document = {
+    {"platform", SDL_GetPlatform()},
+    {"videoDriver", SDL_GetCurrentVideoDriver() ? SDL_GetCurrentVideoDriver() : ""},
+    {"unit", "ms"},
+    {"benchmarks", benchmarks},
+  };
+
+  std::string text = document.dump(2) + "\n";
+  return fwrite(text.data(), 1, text.size(), file) == text.size() && ferror(file) == 0;
+}
+
+/**
+ * Builds a tree of containers with leafCount leaves, branching fanOut ways
+ */
+static SGI::ContainerPtr createTree(int leafCount, int fanOut)
+{
+  std::vector<SGI::WidgetPtr> level;
+  for (int i = 0; i < leafCount; ++i) {
+    SGI::ContainerPtr leaf = SGI::Container::create();
+    leaf->setConstraint(SGI::Widget::ConstraintType::Width, 0, 1 + i % 5);
+    leaf->setConstraint(SGI::Widget::ConstraintType::Height, 0, 1 + i % 3);
+    level.push_back(leaf);
+  }
+
+  bool row = true;
+  while (level.size() > 1) {
+    std::vector<SGI::WidgetPtr> parents;
+    for (size_t i = 0; i < level.size(); i += fanOut) {
+      SGI::ContainerPtr parent = SGI::Container::create();
+      parent->setDirection(row ? SGI::Container::Direction::Row : SGI::Container::Direction::Column);
+      for (size_t j = i; j < level.size() && j < i + fanOut; ++j) {
+        parent->addChild(level[j]);
+      }
+      parents.push_back(parent);
+    }
+    level = parents;
+    row = !row;
+  }
+
+  return std::dynamic_pointer_cast<SGI::Container>(level.front());
+}
+
+static SDL_Event mouseMotion(SGI::WindowPtr window, float x, float y)
+{
+  SDL_Event event;
+  SDL_zero(event);
+  event.type = SDL_EVENT_MOUSE_MOTION;
+  event.motion.windowID = SDL_GetWindowID(window->getWindow().get());
+  event.motion.x = x;
+  event.motion.y = y;
+  return event;
+}
+
+static void benchmarkLayout(SGI::WindowPtr window)
+{
+  for (int count : {100, 1000, 10000}) {
+    SGI::ContainerPtr tree = createTree(count, 10);
+    window->addChild(tree);
+
+    benchmark("layout/tree/" + std::to_string(count), [&]() {
+      tree->setPadding(0, 0, 0, 0);
+    });
+
+    window->removeChild(tree);
+  }
+}
+
+static void benchmarkEvents(SGI::WindowPtr window)
+{
+  SGI::ContainerPtr tree = createTree(1000, 10);
+  window->addChild(tree);
+
+  for (bool routing : {false, true}) {
+    window->setPointerRouting(routing);
+    std::string name = routing ? "events/motion/routed/1000" : "events/motion/broadcast/1000";
+
+    benchmark(name, [&]() {
+      for (int i = 0; i < 100; ++i) {
+        SDL_Event event = mouseMotion(window, (i * 37) % 1280, (i * 53) % 720);
+        window->processEvent(&event);
+      }
+    });
+  }
+
+  window->setPointerRouting(false);
+  window->removeChild(tree);
+}
+
+static void benchmarkText(SGI::WindowPtr window)
+{
+  SDL_Renderer* renderer = window->getRenderer().get();
+  SDL_Color color = {255, 255, 255, 255};
+  std::string sentence = "The quick brown fox jumps over the lazy dog 0123456789";
+
+  benchmark("text/measure/cold", []() {
+    SGI::FontBook::setMeasureCacheSize(0);
+    SGI::FontBook::setMeasureCacheSize(2048);
+  }, [&]() {
+    int width, height;
+    for (int i = 0; i < 100; ++i) {
+      SGI::FontBook::measure("default", 16, sentence + std::to_string(i), &width, &height);
+    }
+  });
+
+  benchmark("text/measure/warm", [&]() {
+    int width, height;
+    for (int i = 0; i < 100; ++i) {
+      SGI::FontBook::measure("default", 16, sentence + std::to_string(i), &width, &height);
+    }
+  });
+
+  benchmark("text/rasterize/surface", [&]() {
+    SGI::FontBook::render("default", 16, sentence, color);
+  });
+
+  benchmark("text/rasterize/texture", [&]() {
+    std::shared_ptr<SDL_Surface> surface = SGI::FontBook::render("default", 16, sentence, color);
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface.get());
+    SDL_DestroyTexture(texture);
+  });
+
+  benchmark("text/draw/atlas", [&]() {
+    for (int i = 0; i < 20; ++i) {
+      SGI::FontBook::draw(renderer, "default", 16, sentence, color, 0, i * 20.0f);
+    }
+  });
+}
+
+static void benchmarkFlatText(SGI::WindowPtr window)
+{
+  for (int lines : {100, 1000, 10000}) {
+    std::string value;
+    for (int i = 0; i < lines; ++i) {
+      value += "Line " + std::to_string(i) + " of a long document with enough words to wrap across the widget.\n";
+    }
+
+    SGI::FlatTextPtr text = SGI::FlatText::create();
+    window->addChild(text);
+
+    benchmark("flattext/load/" + std::to_string(lines), [&]() {
+      text->setValue("");
+    }, [&]() {
+      text->setValue(value);
+      window->render(false);
+    });
+
+    window->removeChild(text);
+  }
+}
+
+static void benchmarkFlatSelect(SGI::WindowPtr window)
+{
+  for (int count : {10, 100, 1000}) {
+    std::vector<std::string> options;
+    for (int i = 0; i < count; ++i) {
+      options.push_back("Option " + std::to_string(i));
+    }
+
+    SGI::FlatSelectPtr select = SGI::FlatSelect::create();
+    window->addChild(select);
+
+    benchmark("flatselect/options/" + std::to_string(count), [&]() {
+      select->setOptions(options);
+      window->render(false);
+    });
+
+    window->removeChild(select);
+  }
+}
+
+static void benchmarkAudio()
+{
+  // One typical device block of stereo floats
+  const int frames = 512;
+  std::vector<Uint8> buffer(frames * 2 * sizeof(float));
+
+  fprintf(stderr, "Mixing with %s\n", SGI::MixKernel::getName());
+
+  for (int voices : {1, 8, 32, 64}) {
+    for (int i = 0; i < voices; ++i) {
+      std::string id = "bench" + std::to_string(i);
+      SGI::AudioPlayer::newBuffer(id);
+      SGI::AudioPlayer::bufferAddTone(id, 220 + i * 10, 1000, 1, 0);
+      SGI::AudioPlayer::setPan(id, voices > 1 ? i * 2.0f / (voices - 1) - 1.0f : 0.0f);
+      SGI::AudioPlayer::play(id, true);
+    }
+
+    // Changing the gain every block keeps every voice ramping
+    int block = 0;
+    std::string name = "audio/mix/" + std::to_string(voices);
+    benchmark(name, [&]() {
+      for (int i = 0; i < voices; ++i) {
+        SGI::AudioPlayer::setGain("bench" + std::to_string(i), block % 2 ? 0.5f : 0.25f);
+      }
+      ++block;
+    }, [&]() {
+      SDL_memset(buffer.data(), 0, buffer.size());
+      SGI::AudioPlayer::mix(buffer.data(), buffer.size());
+    });
+
+    if (!results.empty() && results.back().name == name) {
+      Result perVoice = results.back();
+      perVoice.name += "/voice";
+      perVoice.mean /= voices;
+      perVoice.median /= voices;
+      perVoice.min /= voices;
+      perVoice.max /= voices;
+      results.push_back(perVoice);
+      fprintf(stderr, "%-48s %10.4f ms\n", perVoice.name.c_str(), perVoice.median);
+    }
+
+    for (int i = 0; i < voices; ++i) {
+      SGI::AudioPlayer::unload("bench" + std::to_string(i));
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* output = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--output" && i + 1 < argc) {
+      output = argv[++i];
+    } else if (arg == "--filter" && i + 1 < argc) {
+      filter = argv[++i];
+    } else {
+      fprintf(stderr, "Usage: %s [--output file.json] [--filter name]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+  SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+  if (!SDL_Init(SDL_INIT_VIDEO)) {
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+      fprintf(stderr, "Unable to initialize SDL: %s\n", SDL_GetError());
+      return 1;
+    }
+  }
+
+  SGI::WindowPtr window = SGI::Window::create("widgets-bench", 1280, 720);
+  if (!window->getRenderer()) {
+    fprintf(stderr, "Unable to create a renderer: %s\n", SDL_GetError());
+    return 1;
+  }
+
+  benchmarkLayout(window);
+  benchmarkEvents(window);
+  benchmarkText(window);
+  benchmarkFlatText(window);
+  benchmarkFlatSelect(window);
+  benchmarkAudio();
+
+  FILE* file = output ? fopen(output, "w") : stdout;
+  if (!file) {
+    fprintf(stderr, "Unable to open %s\n", output);
+    return 1;
+  }
+  bool written = writeResults(file);
+  if (output) {
+    fclose(file);
+  }
+
+  return written ? 0 : 1;
+}
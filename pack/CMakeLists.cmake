@@ -0,0 +1,31 @@
+add_executable(${APP_NAME}-pack
+  pack/main.cpp
+  src/bundle.cpp
+)
+
+target_include_directories(${APP_NAME}-pack PRIVATE
+  ${CMAKE_SOURCE_DIR}/src/include
+  ${sdl3_SOURCE_DIR}/include
+)
+
+if(SDL STREQUAL "STATIC")
+  target_link_libraries(${APP_NAME}-pack
+    SDL3::SDL3-static
+  )
+else()
+  target_link_libraries(${APP_NAME}-pack
+    SDL3::SDL3
+  )
+endif()
+
+# Pack the resources into one file next to the demo
+file(GLOB_RECURSE BUNDLE_RESOURCES ${CMAKE_SOURCE_DIR}/resources/*)
+list(FILTER BUNDLE_RESOURCES EXCLUDE REGEX "CMakeLists\\.cmake$")
+
+add_custom_command(
+  OUTPUT ${CMAKE_BINARY_DIR}/resources.bundle
+  COMMAND ${APP_NAME}-pack --compress ${CMAKE_SOURCE_DIR}/resources ${CMAKE_BINARY_DIR}/resources.bundle
+  DEPENDS ${APP_NAME}-pack ${BUNDLE_RESOURCES}
+  COMMENT "Packing resources.bundle"
+)
+add_custom_target(${APP_NAME}-bundle ALL DEPENDS ${CMAKE_BINARY_DIR}/resources.bundle)
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+#include "bundle.h"
+
+/**
+ * Packs a directory into a resource bundle
+ *
+ * Every file under the directory is added with its path relative to
+ * the directory, so "images/ui/dotRed.png" is loaded the same way from
+ * the bundle as from disk. With --compress each entry is compressed
+ * when that makes it at least an eighth smaller. Compressed entries
+ * are copied out of the bundle when they are first used, while files
+ * that are already compressed, like PNG and OGG, rarely shrink that
+ * much and are served straight from the mapping.
+ */
+
+namespace fs = std::filesystem;
+
+struct File {
+  std::string name;
+  std::vector<Uint8> data;
+  std::vector<Uint8> compressed;
+};
+
+static const size_t DATA_ALIGNMENT = 16;
+
+// Build files that live in the resources directory
+static const char* EXCLUDED[] = {"CMakeLists.cmake"};
+
+static size_t align(size_t value)
+{
+  return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+}
+
+static bool readFile(const fs::path& path, std::vector<Uint8>& data)
+{
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream) {
+    return false;
+  }
+  data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  return !stream.bad();
+}
+
+int main(int argc, char* argv[])
+{
+  bool compress = false;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--compress") {
+      compress = true;
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.size() != 2) {
+    fprintf(stderr, "Usage: %s [--compress] directory output.bundle\n", argv[0]);
+    return 1;
+  }
+
+  fs::path directory = paths[0];
+  std::vector<File> files;
+  std::error_code error;
+  for (fs::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+    if (!it->is_regular_file()) {
+      continue;
+    }
+    std::string fileName = it->path().filename().string();
+    if (std::find(std::begin(EXCLUDED), std::end(EXCLUDED), fileName) != std::end(EXCLUDED)) {
+      continue;
+    }
+
+    File file;
+    file.name = fs::relative(it->path(), directory).generic_string();
+    if (!readFile(it->path(), file.data)) {
+      fprintf(stderr, "Unable to read %s\n", it->path().string().c_str());
+      return 1;
+    }
+    if (compress) {
+      file.compressed = SGI::Bundle::compress(file.data.data(), file.data.size());
+      if (file.compressed.size() > file.data.size() - file.data.size() / 8) {
+        file.compressed.clear();
+      }
+    }
+    files.push_back(std::move(file));
+  }
+  if (error) {
+    fprintf(stderr, "Unable to read %s: %s\n", directory.string().c_str(), error.message().c_str());
+    return 1;
+  }
+
+  // Entries are found with a binary search
+  std::sort(files.begin(), files.end(), [](const File& a, const File& b) {
+    return a.name < b.name;
+  });
+
+  std::vector<SGI::Bundle::Entry> entries;
+  std::string names;
+  for (const File& file : files) {
+    SGI::Bundle::Entry entry;
+    SDL_zero(entry);
+    entry.size = file.data.size();
+    entry.storedSize = file.compressed.empty() ? file.data.size() : file.compressed.size();
+    entry.nameOffset = static_cast<Uint32>(names.size());
+    entry.nameLength = static_cast<Uint16>(file.name.size());
+    entry.compression = static_cast<Uint16>(file.compressed.empty() ? SGI::Bundle::Compression::None : SGI::Bundle::Compression::LZ);
+    entries.push_back(entry);
+    names += file.name;
+  }
+
+  size_t offset = align(sizeof(SGI::Bundle::Header) + entries.size() * sizeof(SGI::Bundle::Entry) + names.size());
+  for (SGI::Bundle::Entry& entry : entries) {
+    entry.offset = offset;
+    offset = align(offset + entry.storedSize);
+  }
+
+  SGI::Bundle::Header header;
+  memcpy(header.magic, SGI::Bundle::MAGIC, sizeof(header.magic));
+  header.version = SGI::Bundle::VERSION;
+  header.count = static_cast<Uint32>(entries.size());
+  header.namesSize = static_cast<Uint32>(names.size());
+
+  FILE* output = fopen(paths[1].c_str(), "wb");
+  if (!output) {
+    fprintf(stderr, "Unable to open %s\n", paths[1].c_str());
+    return 1;
+  }
+
+  static const Uint8 padding[DATA_ALIGNMENT] = {0};
+  size_t written = 0;
+  auto write = [&](const void* data, size_t size) {
+    written += fwrite(data, 1, size, output);
+  };
+  auto pad = [&]() {
+    write(padding, align(written) - written);
+  };
+
+  write(&header, sizeof(header));
+  write(entries.data(), entries.size() * sizeof(SGI::Bundle::Entry));
+  write(names.data(), names.size());
+  size_t stored = 0;
+  for (const File& file : files) {
+    pad();
+    const std::vector<Uint8>& data = file.compressed.empty() ? file.data : file.compressed;
+    write(data.data(), data.size());
+    stored += data.size();
+  }
+
+  bool failed = ferror(output) != 0;
+  if (fclose(output) != 0 || failed) {
+    fprintf(stderr, "Unable to write %s\n", paths[1].c_str());
+    return 1;
+  }
+
+  size_t total = 0;
+  for (const File& file : files) {
+    total += file.data.size();
+  }
+  fprintf(stderr, "Packed %zu files, %zu bytes into %zu bytes\n", files.size(), total, stored);
+
+  return 0;
+}
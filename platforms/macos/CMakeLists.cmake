@@ -55,6 +55,18 @@ if(ENABLE_TESTS)
     ${USERNOTIFICATIONS}
   )
 endif()
+if(ENABLE_BENCH)
+  target_sources(${APP_NAME}-bench PRIVATE ${CMAKE_SOURCE_DIR}/platforms/macos/src/platform.mm)
+  target_link_libraries(${APP_NAME}-bench
+    ${COREFOUNDATION_LIBRARY}
+    ${CORESERVICES_LIBRARY}
+    ${COREMEDIA}
+    ${COREVIDEO}
+    ${FOUNDATION}
+    ${AVFOUNDATION}
+    ${USERNOTIFICATIONS}
+  )
+endif()
 
 if(ENABLE_DEMO)
   # macOS specific settings
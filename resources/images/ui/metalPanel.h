@@ -1,2509 +0,0 @@
-/*
-  metalPanel.h (PNM).
-*/
-static const unsigned char
-  MagickImage[] =
-  {
-    0x50, 0x36, 0x0A, 0x31, 0x30, 0x30, 0x20, 0x31, 0x30, 0x30, 0x0A, 0x32, 
-    0x35, 0x35, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x9C, 0xA1, 0xA9, 0x9C, 0xA2, 0xAA, 0x9C, 0xA3, 0xA9, 0x9C, 0xA3, 0xA9, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9C, 0xA3, 0xA9, 0x9C, 0xA3, 0xA9, 
-    0x9C, 0xA2, 0xAA, 0x9C, 0xA1, 0xAA, 0x88, 0x99, 0x99, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x9D, 0xA8, 0x9B, 0xA2, 0xAB, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9D, 0xA2, 0xAC, 0x94, 0x9C, 0xA4, 
-    0x00, 0x00, 0x00, 0x88, 0x99, 0x99, 0x9D, 0xA2, 0xAC, 0x9E, 0xA4, 0xAD, 
-    0xA7, 0xAD, 0xB6, 0xC9, 0xCF, 0xD8, 0xD8, 0xDE, 0xE6, 0xD8, 0xDE, 0xE6, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xD8, 0xDE, 0xE6, 0xD8, 0xDE, 0xE6, 
-    0xC9, 0xCF, 0xD8, 0xA7, 0xAD, 0xB6, 0x9E, 0xA4, 0xAD, 0x9C, 0xA2, 0xAB, 
-    0x00, 0x00, 0x00, 0x9D, 0xA3, 0xAB, 0x9E, 0xA4, 0xAD, 0xA7, 0xAD, 0xB6, 
-    0xE7, 0xED, 0xF5, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xE7, 0xED, 0xF5, 0xA7, 0xAD, 0xB6, 0x9E, 0xA4, 0xAD, 
-    0x9C, 0xA1, 0xA9, 0x9B, 0xA2, 0xAB, 0x9E, 0xA4, 0xAD, 0xD3, 0xD9, 0xE1, 
-    0xEC, 0xF2, 0xFA, 0xE7, 0xEE, 0xF6, 0xDC, 0xE3, 0xEC, 0xDB, 0xE2, 0xEB, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xDB, 0xE2, 0xEB, 0xDC, 0xE3, 0xEC, 
-    0xE7, 0xEE, 0xF6, 0xEC, 0xF2, 0xFA, 0xD3, 0xD9, 0xE1, 0x9E, 0xA4, 0xAD, 
-    0x9C, 0xA2, 0xAA, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD8, 0xDF, 0xE9, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD8, 0xDF, 0xE9, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEA, 0xF0, 0xF8, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xC8, 0xCE, 0xD8, 
-    0xAF, 0xB5, 0xBF, 0xAF, 0xB5, 0xBF, 0xC8, 0xCE, 0xD8, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xC8, 0xCE, 0xD8, 
-    0xAF, 0xB5, 0xBF, 0xAF, 0xB5, 0xBF, 0xC8, 0xCE, 0xD8, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA8, 0xAE, 0xB7, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA8, 0xAE, 0xB7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA8, 0xAE, 0xB7, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA8, 0xAE, 0xB7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA5, 0xAB, 0xB4, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA5, 0xAB, 0xB4, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA5, 0xAB, 0xB4, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA5, 0xAB, 0xB4, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xBD, 0xC4, 0xCD, 
-    0xA1, 0xA7, 0xB0, 0xA1, 0xA7, 0xB0, 0xBD, 0xC4, 0xCD, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xBD, 0xC4, 0xCD, 
-    0xA1, 0xA7, 0xB0, 0xA1, 0xA7, 0xB0, 0xBD, 0xC4, 0xCD, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xC8, 0xCE, 0xD8, 
-    0xAF, 0xB5, 0xBF, 0xAF, 0xB5, 0xBF, 0xC8, 0xCE, 0xD8, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xC8, 0xCE, 0xD8, 
-    0xAF, 0xB5, 0xBF, 0xAF, 0xB5, 0xBF, 0xC8, 0xCE, 0xD8, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA8, 0xAE, 0xB7, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA8, 0xAE, 0xB7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA8, 0xAE, 0xB7, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA8, 0xAE, 0xB7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA5, 0xAB, 0xB4, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA5, 0xAB, 0xB4, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xA5, 0xAB, 0xB4, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xA5, 0xAB, 0xB4, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xBD, 0xC4, 0xCD, 
-    0xA1, 0xA7, 0xB0, 0xA1, 0xA7, 0xB0, 0xBD, 0xC4, 0xCD, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xBD, 0xC4, 0xCD, 
-    0xA1, 0xA7, 0xB0, 0xA1, 0xA7, 0xB0, 0xBD, 0xC4, 0xCD, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0xE2, 0xE8, 0xF0, 
-    0xEC, 0xF2, 0xFA, 0xDA, 0xE0, 0xEA, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xDB, 0xE2, 0xEB, 0xEC, 0xF2, 0xFA, 0xE2, 0xE8, 0xF0, 0x9E, 0xA4, 0xAD, 
-    0x9D, 0xA2, 0xAC, 0x9C, 0xA3, 0xA9, 0x9E, 0xA4, 0xAD, 0xCE, 0xD4, 0xDD, 
-    0xEC, 0xF2, 0xFA, 0xE7, 0xEE, 0xF6, 0xD8, 0xDF, 0xE9, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 
-    0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD6, 0xDD, 0xE7, 0xD8, 0xDF, 0xE9, 
-    0xE7, 0xEE, 0xF6, 0xEC, 0xF2, 0xFA, 0xCE, 0xD4, 0xDD, 0x9E, 0xA4, 0xAD, 
-    0x9C, 0xA3, 0xA9, 0x9C, 0xA1, 0xAA, 0x9E, 0xA4, 0xAD, 0xA7, 0xAD, 0xB6, 
-    0xE7, 0xED, 0xF5, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xE7, 0xED, 0xF5, 0xA7, 0xAD, 0xB6, 0x9E, 0xA4, 0xAD, 
-    0x9C, 0xA1, 0xAA, 0x88, 0x99, 0x99, 0x9B, 0xA2, 0xAB, 0x9E, 0xA4, 0xAD, 
-    0xAC, 0xB2, 0xBB, 0xD8, 0xDE, 0xE6, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 0xEC, 0xF2, 0xFA, 
-    0xD8, 0xDE, 0xE6, 0xAC, 0xB2, 0xBB, 0x9E, 0xA4, 0xAD, 0x9D, 0xA2, 0xAC, 
-    0x88, 0x99, 0x99, 0x00, 0x00, 0x00, 0x98, 0x9D, 0xA8, 0x9D, 0xA2, 0xAC, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9C, 0xA2, 0xAB, 0x98, 0x9D, 0xA8, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x99, 0x99, 
-    0x9B, 0xA2, 0xAB, 0x9D, 0xA2, 0xAC, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 0x9E, 0xA4, 0xAD, 
-    0x9C, 0xA2, 0xAB, 0x9C, 0xA1, 0xAA, 0x88, 0x99, 0x99, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00
-  };
@@ -1,49 +0,0 @@
-/*
-  test.h (PNM).
-*/
-static const unsigned char
-  MagickImage[] =
-  {
-    0x50, 0x35, 0x0A, 0x32, 0x30, 0x20, 0x32, 0x34, 0x0A, 0x32, 0x35, 0x35, 
-    0x0A, 0xB2, 0xB5, 0xB5, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xB7, 0xB7, 
-    0xB4, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xD2, 0xB7, 0xB7, 0xB4, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB7, 0xB7, 0xFF, 0xDF, 0xB7, 0xB7, 0xB5, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xE4, 0xB7, 0xB7, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xE4, 0xBB, 
-    0xB7, 0xB5, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xBB, 0xB7, 0xB5, 0xAA, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xBB, 0xB7, 0xB5, 0xAD, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFA, 0xC4, 0xB7, 0xB4, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xC4, 
-    0xB7, 0xB4, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xCD, 0xB7, 0xB7, 0xB4, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xB7, 0xB7, 0xB5, 0x00, 0x00, 0x00, 
-    0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xD6, 0xB7, 0xB7, 0xB5, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 
-    0xB7, 0xB7, 0xB5, 0xAA, 0x00, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xB7, 0xB7, 0xB5, 
-    0xAA, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xBB, 0xB7, 0xB5, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 
-    0xC9, 0xC9, 0xC0, 0xB7, 0xB4, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 
-    0xD2, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 
-    0xB5, 0xB7, 0xB7, 0xFF, 0xFF, 0xFF, 0xF1, 0xC4, 0xB7, 0xB4, 0xB5, 0xB2, 
-    0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x00, 0xB7, 0xB7, 0xFF, 
-    0xFF, 0xE8, 0xBB, 0xB7, 0xB5, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xB7, 0xFF, 0xD6, 0xB7, 0xB7, 0xB5, 
-    0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB7, 0xB7, 0xC9, 0xB7, 0xB7, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xB7, 0xB7, 
-    0xB4, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xB5, 0xB4, 0xAA, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00
-  };
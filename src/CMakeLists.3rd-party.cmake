@@ -135,3 +135,9 @@ if(NOT nlohmann_json_FOUND OR ENABLE_EXTERNAL_STATIC)
   )
   FetchContent_MakeAvailable(nlohmann_json)
 endif()
+
+#
+# Threads
+#
+
+find_package(Threads REQUIRED)
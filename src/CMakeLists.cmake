@@ -2,9 +2,12 @@ include(src/CMakeLists.3rd-party.cmake)
 
 # Define library sources (exclude main.cpp)
 set(LIBRARY_SOURCES
+  ${CMAKE_SOURCE_DIR}/src/assetloader.cpp
   ${CMAKE_SOURCE_DIR}/src/audioplayer.cpp
+  ${CMAKE_SOURCE_DIR}/src/bundle.cpp
   ${CMAKE_SOURCE_DIR}/src/button.cpp
   ${CMAKE_SOURCE_DIR}/src/container.cpp
+  ${CMAKE_SOURCE_DIR}/src/drawlist.cpp
   ${CMAKE_SOURCE_DIR}/src/flat.cpp
   ${CMAKE_SOURCE_DIR}/src/flatbutton.cpp
   ${CMAKE_SOURCE_DIR}/src/flatdivider.cpp
@@ -18,9 +21,12 @@ set(LIBRARY_SOURCES
   ${CMAKE_SOURCE_DIR}/src/flatvideo.cpp
   ${CMAKE_SOURCE_DIR}/src/fontbook.cpp
   ${CMAKE_SOURCE_DIR}/src/i18n.cpp
+  ${CMAKE_SOURCE_DIR}/src/mixkernel.cpp
   ${CMAKE_SOURCE_DIR}/src/optiongroup.cpp
   ${CMAKE_SOURCE_DIR}/src/panel.cpp
+  ${CMAKE_SOURCE_DIR}/src/profiler.cpp
   ${CMAKE_SOURCE_DIR}/src/state.cpp
+  ${CMAKE_SOURCE_DIR}/src/theme.cpp
   ${CMAKE_SOURCE_DIR}/src/widget.cpp
   ${CMAKE_SOURCE_DIR}/src/window.cpp
 )
@@ -51,6 +57,7 @@ if (ENABLE_STATIC)
       SDL3_net::SDL3_net-static
       SDL3_ttf::SDL3_ttf-static ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   else()
     target_link_libraries(${APP_NAME}-static
@@ -60,6 +67,7 @@ if (ENABLE_STATIC)
       SDL3_net::SDL3_net
       SDL3_ttf::SDL3_ttf ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   endif()
 endif()
@@ -84,6 +92,7 @@ if (ENABLE_SHARED)
       SDL3_net::SDL3_net-static
       SDL3_ttf::SDL3_ttf-static ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   else()
     target_link_libraries(${APP_NAME}-shared
@@ -93,6 +102,7 @@ if (ENABLE_SHARED)
       SDL3_net::SDL3_net
       SDL3_ttf::SDL3_ttf ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   endif()
 endif()
@@ -116,6 +126,7 @@ if(ENABLE_DEMO)
       SDL3_net::SDL3_net-static
       SDL3_ttf::SDL3_ttf-static ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   else()
     target_link_libraries(${APP_NAME}
@@ -125,6 +136,7 @@ if(ENABLE_DEMO)
       SDL3_net::SDL3_net
       SDL3_ttf::SDL3_ttf ${FREETYPE_LIBRARIES}
       vorbisenc vorbisfile vorbis
+      Threads::Threads
     )
   endif()
 endif()
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cstdlib>
+#include <SDL3/SDL.h>
+#include "assetloader.h"
+#include "debug.h"
+#include "profiler.h"
+
+namespace SGI {
+  AssetLoader* AssetLoader::_instance = nullptr;
+
+  static const int MAX_WORKERS = 4;
+
+  void AssetLoader::initialize()
+  {
+    if (_instance == nullptr) {
+      _instance = new AssetLoader();
+    }
+  }
+
+  AssetLoader::AssetLoader()
+  {
+    _eventType = SDL_RegisterEvents(1);
+
+    // Leave a core for the main thread
+    int count = std::clamp(SDL_GetNumLogicalCPUCores() - 1, 1, MAX_WORKERS);
+    for (int i = 0; i < count; ++i) {
+      _workers.emplace_back(&AssetLoader::_work, this);
+    }
+    LOG(ASSETLOADER, "Started %d workers", count);
+
+    if (atexit([](){
+      shutdown();
+    }) != 0) {
+      ERROR(ASSETLOADER, "atexit Error: Failed to register the AssetLoader shutdown");
+    }
+  }
+
+  AssetLoader::~AssetLoader()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+    }
+    _condition.notify_all();
+    for (std::thread& worker : _workers) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    LOG(ASSETLOADER, "Stopped %d workers", static_cast<int>(_workers.size()));
+  }
+
+  size_t AssetLoader::getPendingCount()
+  {
+    initialize();
+
+    return _instance->_pending;
+  }
+
+  AssetPtr AssetLoader::load(const std::function<bool()>& decode, const std::function<bool()>& upload, const Callback& callback)
+  {
+    initialize();
+
+    AssetPtr asset = std::make_shared<Asset>();
+    _instance->_pending++;
+    {
+      std::lock_guard<std::mutex> lock(_instance->_mutex);
+      _instance->_decodeQueue.push_back({asset, decode, upload, callback, false});
+    }
+    _instance->_condition.notify_one();
+
+    return asset;
+  }
+
+  void AssetLoader::shutdown()
+  {
+    delete _instance;
+    _instance = nullptr;
+  }
+
+  int AssetLoader::update(double budget)
+  {
+    if (_instance == nullptr) {
+      return 0;
+    }
+
+    int finished = 0;
+    double start = Profiler::milliseconds();
+    do {
+      Job job;
+      {
+        std::lock_guard<std::mutex> lock(_instance->_mutex);
+        if (_instance->_uploadQueue.empty()) {
+          break;
+        }
+        job = std::move(_instance->_uploadQueue.front());
+        _instance->_uploadQueue.pop_front();
+      }
+
+      bool success = job.decoded && (!job.upload || job.upload());
+      job.asset->_state = success ? State::Ready : State::Failed;
+      _instance->_pending--;
+      if (job.callback) {
+        job.callback(success);
+      }
+      finished++;
+    } while (Profiler::milliseconds() - start < budget);
+
+    return finished;
+  }
+
+  void AssetLoader::_work()
+  {
+    while (true) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _stopping || !_decodeQueue.empty(); });
+        if (_stopping) {
+          return;
+        }
+        job = std::move(_decodeQueue.front());
+        _decodeQueue.pop_front();
+      }
+
+      job.decoded = !job.decode || job.decode();
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _uploadQueue.push_back(std::move(job));
+      }
+
+      if (_eventType != 0) {
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = _eventType;
+        SDL_PushEvent(&event);
+      }
+    }
+  }
+}
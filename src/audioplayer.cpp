@@ -1,12 +1,252 @@
+#include <algorithm>
+#include <chrono>
 #include <SDL3/SDL.h>
 #include <vorbis/codec.h>
 #include <vorbis/vorbisfile.h>
 #include "debug.h"
 #include "audioplayer.h"
+#include "bundle.h"
+#include "mixkernel.h"
+
+#define MINIMP3_IMPLEMENTATION
+#include "vendor/minimp3_ex.h"
 
 namespace SGI {
   AudioPlayer* AudioPlayer::_instance = nullptr;
 
+  // How long play and friends wait for the audio thread to empty a full queue
+  static const int SEND_ATTEMPTS = 100;
+
+  // Bytes decoded at a time, and how often streams are topped up
+  static const int DECODE_BLOCK_SIZE = 4096;
+  static const int STREAM_FILL_INTERVAL = 10;
+
+  /**
+   * Decodes a compressed file a block at a time
+   */
+  class AudioDecoder {
+  public:
+    virtual ~AudioDecoder() { }
+
+    /**
+     * Opens a decoder for the format named by magic
+     *
+     * \param io the file, closed by the decoder
+     * \returns the decoder, or nullptr if the file can't be decoded
+     */
+    static std::unique_ptr<AudioDecoder> open(SDL_IOStream* io, const std::string& magic, const std::string& filename);
+
+    /**
+     * Decodes the next samples in spec
+     *
+     * \returns the bytes decoded, 0 at the end of the file
+     */
+    virtual int read(Uint8* buffer, int length) = 0;
+
+    virtual bool seek(Uint64 frame) = 0;
+
+    SDL_AudioSpec spec;
+  };
+
+  class VorbisDecoder : public AudioDecoder {
+  public:
+    VorbisDecoder(SDL_IOStream* io) : _io(io) { }
+
+    ~VorbisDecoder()
+    {
+      if (_open) {
+        ov_clear(&_file);
+      }
+      SDL_CloseIO(_io);
+    }
+
+    bool open()
+    {
+      static const ov_callbacks callbacks{
+        [](void* buffer, size_t elementSize, size_t elementCount, void* dataSource)->size_t {
+          return SDL_ReadIO((SDL_IOStream*)dataSource, buffer, elementCount * elementSize);
+        },
+        [](void* dataSource, ogg_int64_t offset, int origin)->int {
+          static const std::vector<SDL_IOWhence> seekDirections{
+            SDL_IO_SEEK_SET, SDL_IO_SEEK_CUR, SDL_IO_SEEK_END
+          };
+          return SDL_SeekIO((SDL_IOStream*)dataSource, offset, seekDirections.at(origin)) < 0 ? -1 : 0;
+        },
+        nullptr,
+        [](void* dataSource)->long {
+          return SDL_TellIO((SDL_IOStream*)dataSource);
+        }
+      };
+
+      if (ov_open_callbacks(_io, &_file, NULL, 0, callbacks) < 0) {
+        return false;
+      }
+      _open = true;
+
+      vorbis_info* vi = ov_info(&_file, -1);
+      SDL_zero(spec);
+      spec.freq = vi->rate;
+      spec.channels = vi->channels;
+      spec.format = SDL_AUDIO_S16;
+      return true;
+    }
+
+    int read(Uint8* buffer, int length) override
+    {
+      int bitstream;
+      long bytesRead = ov_read(&_file, (char*)buffer, length, 0, 2, 1, &bitstream);
+      return bytesRead > 0 ? static_cast<int>(bytesRead) : 0;
+    }
+
+    bool seek(Uint64 frame) override
+    {
+      return ov_pcm_seek(&_file, static_cast<ogg_int64_t>(frame)) == 0;
+    }
+
+  private:
+    SDL_IOStream* _io;
+    OggVorbis_File _file;
+    bool _open = false;
+  };
+
+  class Mp3Decoder : public AudioDecoder {
+  public:
+    Mp3Decoder(SDL_IOStream* io) : _io(io)
+    {
+      SDL_zero(_decoder);
+      _callbacks.read = [](void* buffer, size_t size, void* userData)->size_t {
+        return SDL_ReadIO((SDL_IOStream*)userData, buffer, size);
+      };
+      _callbacks.read_data = io;
+      _callbacks.seek = [](uint64_t position, void* userData)->int {
+        return SDL_SeekIO((SDL_IOStream*)userData, position, SDL_IO_SEEK_SET) < 0 ? -1 : 0;
+      };
+      _callbacks.seek_data = io;
+    }
+
+    ~Mp3Decoder()
+    {
+      mp3dec_ex_close(&_decoder);
+      SDL_CloseIO(_io);
+    }
+
+    bool open()
+    {
+      // Seek points are indexed when first needed instead of scanning the whole file now
+      if (mp3dec_ex_open_cb(&_decoder, &_callbacks, MP3D_SEEK_TO_SAMPLE | MP3D_DO_NOT_SCAN) != 0) {
+        return false;
+      }
+      if (_decoder.info.channels <= 0 || _decoder.info.hz <= 0) {
+        return false;
+      }
+
+      SDL_zero(spec);
+      spec.freq = _decoder.info.hz;
+      spec.channels = _decoder.info.channels;
+      spec.format = SDL_AUDIO_S16;
+      return true;
+    }
+
+    int read(Uint8* buffer, int length) override
+    {
+      size_t samples = mp3dec_ex_read(&_decoder, reinterpret_cast<mp3d_sample_t*>(buffer), length / sizeof(mp3d_sample_t));
+      return static_cast<int>(samples * sizeof(mp3d_sample_t));
+    }
+
+    bool seek(Uint64 frame) override
+    {
+      // minimp3 counts each channel's sample
+      return mp3dec_ex_seek(&_decoder, frame * spec.channels) == 0;
+    }
+
+  private:
+    SDL_IOStream* _io;
+    mp3dec_io_t _callbacks;
+    mp3dec_ex_t _decoder;
+  };
+
+  /**
+   * Checks for an ID3 tag or an MPEG audio frame header
+   */
+  static bool isMp3(const std::string& magic)
+  {
+    if (magic.compare(0, 3, "ID3") == 0) {
+      return true;
+    }
+    Uint8 first = magic[0];
+    Uint8 second = magic[1];
+    return first == 0xFF && (second & 0xE0) == 0xE0 && (second & 0x06) != 0;
+  }
+
+  std::unique_ptr<AudioDecoder> AudioDecoder::open(SDL_IOStream* io, const std::string& magic, const std::string& filename)
+  {
+    if (magic == "OggS") {
+      auto decoder = std::make_unique<VorbisDecoder>(io);
+      if (!decoder->open()) {
+        ERROR(AUDIOPLAYER, "Failed to open OGG file %s", filename.c_str());
+        return nullptr;
+      }
+      return decoder;
+    }
+    if (isMp3(magic)) {
+      auto decoder = std::make_unique<Mp3Decoder>(io);
+      if (!decoder->open()) {
+        ERROR(AUDIOPLAYER, "Failed to open MP3 file %s", filename.c_str());
+        return nullptr;
+      }
+      return decoder;
+    }
+
+    SDL_CloseIO(io);
+    ERROR(AUDIOPLAYER, "Failed to load file %s: Unknown file type (%s)", filename.c_str(), magic.c_str());
+    return nullptr;
+  }
+
+  /**
+   * Works out the channel gains for a voice
+   *
+   * Pan is a balance control, since sounds are already stereo. The
+   * louder side keeps the full gain.
+   */
+  static void getChannelGains(float gain, float pan, float& left, float& right)
+  {
+    left = gain * std::min(1.0f, 1.0f - pan);
+    right = gain * std::min(1.0f, 1.0f + pan);
+  }
+
+  /**
+   * Packs a voice and the play it is used for into a handle
+   */
+  static AudioPlayer::VoiceHandle makeHandle(int voice, Uint32 sequence)
+  {
+    return (static_cast<Uint64>(sequence) << 32) | static_cast<Uint32>(voice);
+  }
+
+  /**
+   * Reads the first four bytes of a file and goes back to the start
+   */
+  static std::string readMagic(SDL_IOStream* io)
+  {
+    char magic[4] = {0, 0, 0, 0};
+    if (SDL_ReadIO(io, magic, sizeof(magic)) != sizeof(magic)) {
+      ERROR(AUDIOPLAYER, "Failed to read file header.");
+    }
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+    return std::string(magic, sizeof(magic));
+  }
+
+  // Out of line, where AudioDecoder is complete
+  AudioPlayer::Stream::Stream()
+  {
+  }
+
+  AudioPlayer::Stream::~Stream()
+  {
+    if (converter) {
+      SDL_DestroyAudioStream(converter);
+    }
+  }
+
   void AudioPlayer::initialize()
   {
     if(_instance == nullptr) {
@@ -16,6 +256,8 @@ namespace SGI {
 
   AudioPlayer::AudioPlayer()
   {
+    _mixBuffer.resize(MIX_BUFFER_SIZE);
+
     if (!SDL_Init(SDL_INIT_AUDIO)) {
       ERROR(AUDIOPLAYER, "Failed to initialize SDL Audio: %s", SDL_GetError());
       return;
@@ -24,10 +266,10 @@ namespace SGI {
     SDL_AudioSpec desiredSpec;
     SDL_zero(desiredSpec);
     desiredSpec.format = SDL_AUDIO_F32;
-    desiredSpec.channels = 2;
+    desiredSpec.channels = CHANNELS;
     desiredSpec.freq = 44100;
 
-    _stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &desiredSpec, AudioPlayer::_audioCallback, nullptr);
+    _stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &desiredSpec, AudioPlayer::_audioCallback, this);
     if (!_stream) {
       ERROR(AUDIOPLAYER, "Failed to open audio stream: %s", SDL_GetError());
       return;
@@ -43,7 +285,7 @@ namespace SGI {
 
     _deviceId = SDL_GetAudioStreamDevice(_stream);
     _deviceName = std::string(SDL_GetAudioDeviceName(_deviceId));
-    LOG(AUDIOPLAYER, "Opened device %s, freq: %d, chan: %d, format: 0x%X", _deviceName.c_str(), _obtainedSpec.freq, _obtainedSpec.channels, _obtainedSpec.format);
+    LOG(AUDIOPLAYER, "Opened device %s, freq: %d, chan: %d, format: 0x%X, mixer: %s", _deviceName.c_str(), _obtainedSpec.freq, _obtainedSpec.channels, _obtainedSpec.format, MixKernel::getName());
 
     const char *basePath = SDL_GetBasePath();
     if (basePath) {
@@ -55,165 +297,138 @@ namespace SGI {
 
   AudioPlayer::~AudioPlayer()
   {
-    for (auto& entry : _audioDataMap) {
-      SDL_free(entry.second.start);
-    }
-
+    // Stop the audio and decoder threads before the samples they use are freed
     if (_stream) {
       SDL_DestroyAudioStream(_stream);
     }
+    if (_streamThread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(_streamMutex);
+        _streaming = false;
+      }
+      _streamCondition.notify_one();
+      _streamThread.join();
+    }
   }
 
-  bool AudioPlayer::isPlaying(const std::string& id)
+  size_t AudioPlayer::getRetiredBytes()
   {
-    initialize();
+    if (!_instance) {
+      return 0;
+    }
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      return it->second.playing;
+    size_t bytes = 0;
+    for (const auto& retired : _instance->_retired) {
+      bytes += retired.second->length;
     }
-    return false;
+    return bytes;
   }
 
-  bool AudioPlayer::load(const std::string& id, const std::string& filename)
+  bool AudioPlayer::isPlaying(const std::string& id)
   {
     initialize();
 
-    SDL_IOStream* fio = SDL_IOFromFile((_instance->_resourcePath + filename).c_str(), "r");
-    if (!fio) {
-      ERROR(AUDIOPLAYER, "Could not open file %s: %s", (_instance->_resourcePath + filename).c_str(), SDL_GetError());
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
       return false;
     }
-    
-    char magicBuffer[4];
-    do {
-      if(SDL_ReadIO(fio, magicBuffer, 4) != 4) {
-        ERROR(AUDIOPLAYER, "Failed to read file header.");
+    for (int voice : _instance->_getVoices(clip)) {
+      if (!_instance->_instances[voice].paused) {
+        return true;
       }
-    } while (magicBuffer[0] == 0);
-    std::string magic = std::string(magicBuffer, 4);
-
-    SDL_SeekIO(fio, 0, SDL_IO_SEEK_SET);
-
-    if (magic == "RIFF") {
-      SDL_AudioSpec fileSpec;
-      Uint8* fileBuffer;
-      Uint32 fileLength;
-
-      if (!SDL_LoadWAV_IO(fio, SDL_TRUE, &fileSpec, &fileBuffer, &fileLength)) {
-        ERROR(AUDIOPLAYER, "Failed to load WAV file %s: %s", filename.c_str(), SDL_GetError());
-        return false;
-      }
-      LOG(AUDIOPLAYER, "Loaded %s (%d len), freq: %d chan: %d format: 0x%X", filename.c_str(), fileLength, fileSpec.freq, fileSpec.channels, fileSpec.format);
-
-      Uint8* wavBuffer;
-      int wavLength;
+    }
+    return false;
+  }
 
-      SDL_ConvertAudioSamples(&fileSpec, fileBuffer, fileLength, &_instance->_obtainedSpec, &wavBuffer, &wavLength);
-      SDL_free(fileBuffer);
+  bool AudioPlayer::isPlaying(VoiceHandle handle)
+  {
+    initialize();
 
-      // Store the audio data in the map
-      AudioData audioData;
-      audioData.start = wavBuffer;
-      audioData.pos = wavBuffer;
-      audioData.length = wavLength;
-      audioData.totalLength = wavLength;
-      audioData.playing = false;
-      audioData.repeating = false;
+    int voice = _instance->_getVoice(handle);
+    return voice >= 0 && !_instance->_instances[voice].paused;
+  }
 
-      _instance->_audioDataMap[id] = audioData;
-      return true;
-    } else if (magic == "OggS") {
-      const ov_callbacks callbacks{
-        [](void* buffer, size_t elementSize, size_t elementCount, void* dataSource)->size_t {
-          return SDL_ReadIO((SDL_IOStream*)dataSource, buffer, elementCount * elementSize);
-        },
-        [](void* dataSource, ogg_int64_t offset, int origin)->int {
-          static const std::vector<SDL_IOWhence> seekDirections{
-            SDL_IO_SEEK_SET, SDL_IO_SEEK_CUR, SDL_IO_SEEK_END
-          };
-          return SDL_SeekIO((SDL_IOStream*)dataSource, offset, seekDirections.at(origin));
-        },
-        nullptr,
-        [](void* dataSource)->long {
-          return SDL_TellIO((SDL_IOStream*)dataSource);
-        }
-      };
+  bool AudioPlayer::load(const std::string& id, const std::string& filename)
+  {
+    initialize();
 
-      OggVorbis_File vf;
-      if (ov_open_callbacks(fio, &vf, NULL, 0, callbacks) < 0) {
-        SDL_CloseIO(fio);
-        ERROR(AUDIOPLAYER, "Failed to open OGG file %s", filename.c_str());
-        return false;
-      }
+    auto sample = std::make_unique<Sample>();
+    if (!_decode(_instance->_resourcePath, filename, *sample)) {
+      return false;
+    }
 
-      vorbis_info* vi = ov_info(&vf, -1);
+    return _instance->_publish(id, std::move(sample));
+  }
 
-      SDL_AudioSpec fileSpec;
-      SDL_zero(fileSpec);
-      fileSpec.freq = vi->rate;
-      fileSpec.channels = vi->channels;
-      fileSpec.format = SDL_AUDIO_S16;
+  AssetPtr AudioPlayer::loadAsync(const std::string& id, const std::string& filename, const AssetLoader::Callback& callback)
+  {
+    initialize();
 
+    std::string resourcePath = _instance->_resourcePath;
+    auto sample = std::make_shared<std::unique_ptr<Sample>>(std::make_unique<Sample>());
 
-      Uint32 totalSamples = static_cast<Uint32>(ov_pcm_total(&vf, -1)) * vi->channels;
-      Uint32 bufferSize = totalSamples * sizeof(float);
-      Uint8* buffer = new Uint8[bufferSize];
-      Uint8* currentPos = buffer;
+    return AssetLoader::load([resourcePath, filename, sample]() {
+      return _decode(resourcePath, filename, **sample);
+    }, [id, sample]() {
+      return _instance->_publish(id, std::move(*sample));
+    }, callback);
+  }
 
-      LOG(AUDIOPLAYER, "Loaded %s (%d len), freq: %d chan: %d format: 0x%X", filename.c_str(), bufferSize, fileSpec.freq, fileSpec.channels, fileSpec.format);
+  bool AudioPlayer::loadStream(const std::string& id, const std::string& filename)
+  {
+    initialize();
 
-      int bitstream;
-      long bytesRead;
-      while ((bytesRead = ov_read(&vf, (char*)currentPos, bufferSize - (currentPos - buffer), 0, 2, 1, &bitstream)) > 0) {
-        currentPos += bytesRead;
-      }
+    SDL_IOStream* fio = Bundle::openResource(_instance->_resourcePath, filename);
+    if (!fio) {
+      ERROR(AUDIOPLAYER, "Could not open file %s: %s", (_instance->_resourcePath + filename).c_str(), SDL_GetError());
+      return false;
+    }
 
-      ov_clear(&vf);
+    std::string magic = readMagic(fio);
+    if (magic == "RIFF") {
       SDL_CloseIO(fio);
+      return load(id, filename);
+    }
 
-      Uint8* oggBuffer;
-      int oggLength;
-
-      if (!SDL_ConvertAudioSamples(&fileSpec, buffer, bufferSize, &_instance->_obtainedSpec, &oggBuffer, &oggLength)) {
-        ERROR(AUDIOPLAYER, "Failed to convert autiod format %s: %s", filename.c_str(), SDL_GetError());
-        delete[] buffer;
-        return false;
-      }
-      delete[] buffer;
+    std::unique_ptr<AudioDecoder> decoder = AudioDecoder::open(fio, magic, filename);
+    if (!decoder) {
+      return false;
+    }
 
-      // Store the audio data in the map
-      AudioData audioData;
-      audioData.start = oggBuffer;
-      audioData.pos = oggBuffer;
-      audioData.length = oggLength;
-      audioData.totalLength = oggLength;
-      audioData.playing = false;
-      audioData.repeating = false;
+    auto sample = std::make_unique<Sample>();
+    sample->stream = std::make_unique<Stream>();
+    Stream* stream = sample->stream.get();
+    stream->converter = SDL_CreateAudioStream(&decoder->spec, &_instance->_obtainedSpec);
+    if (!stream->converter) {
+      ERROR(AUDIOPLAYER, "Failed to convert audio format %s: %s", filename.c_str(), SDL_GetError());
+      return false;
+    }
+    stream->decoder = std::move(decoder);
+    stream->ring = std::make_unique<Uint8[]>(STREAM_BUFFER_SIZE);
 
-      _instance->_audioDataMap[id] = audioData;
-      return true;
+    if (!_instance->_publish(id, std::move(sample))) {
+      return false;
     }
 
-    SDL_CloseIO(fio);
-    ERROR(AUDIOPLAYER, "Failed to load file %s: Unknown file type (%s)", filename.c_str(), magic.c_str());
+    {
+      std::lock_guard<std::mutex> lock(_instance->_streamMutex);
+      if (!_instance->_streaming) {
+        _instance->_streaming = true;
+        _instance->_streamThread = std::thread(&AudioPlayer::_streamLoop, _instance);
+      }
+      _instance->_streams.push_back(stream);
+    }
+    _instance->_streamCondition.notify_one();
 
-    return false;
+    LOG(AUDIOPLAYER, "Streaming %s, freq: %d chan: %d format: 0x%X", filename.c_str(), stream->decoder->spec.freq, stream->decoder->spec.channels, stream->decoder->spec.format);
+    return true;
   }
 
   void AudioPlayer::newBuffer(const std::string& id)
   {
     initialize();
 
-    AudioData audioData;
-    audioData.start = nullptr;
-    audioData.pos = nullptr;
-    audioData.length = 0;
-    audioData.totalLength = 0;
-    audioData.playing = false;
-    audioData.repeating = false;
-
-    _instance->_audioDataMap[id] = audioData;
+    _instance->_publish(id, std::make_unique<Sample>());
   }
 
   bool AudioPlayer::bufferAddTone(const std::string& id, int freq, int duration, int cycles, int delay)
@@ -224,12 +439,12 @@ namespace SGI {
       return false;
     }
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it == _instance->_audioDataMap.end()) {
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
       ERROR(AUDIOPLAYER, "Buffer ID %s not found", id.c_str());
       return false;
     }
-    AudioData& audioData = it->second;
+    const Sample* current = clip->sample.get();
 
     // LOG(AUDIOPLAYER, "bufferAddTone, freq: %d, dureation: %d, cycles: %d, dealy: %d", freq, duration, cycles, delay);
 
@@ -239,18 +454,21 @@ namespace SGI {
     int delaySamples = sampleRate * delay / 1000;
     int cycleSamples = (numSamples + fadeSamples + delaySamples) * cycles;
 
-    Uint8* newBuffer = new Uint8[audioData.totalLength + cycleSamples * sizeof(float)];
-    if (!newBuffer) {
+    // The playing sample can't be changed, so the tone is added to a copy
+    auto sample = std::make_unique<Sample>();
+    sample->length = current->length + cycleSamples * sizeof(float);
+    sample->data = static_cast<Uint8*>(SDL_malloc(sample->length));
+    if (!sample->data) {
       ERROR(AUDIOPLAYER, "Failed to allocate memory for tone buffer");
       return false;
     }
 
-    if (audioData.start) {
-      SDL_memcpy(newBuffer, audioData.start, audioData.totalLength);
-      delete[] audioData.start;
+    if (current->data) {
+      SDL_memcpy(sample->data, current->data, current->length);
     }
+    SDL_memset(sample->data + current->length, 0, sample->length - current->length);
 
-    float* buffer = reinterpret_cast<float*>(newBuffer + audioData.totalLength);
+    float* buffer = reinterpret_cast<float*>(sample->data + current->length);
 
     for (int i = 0; i < cycles; ++i) {
         for (int j = 0; j < numSamples; ++j) {
@@ -268,12 +486,7 @@ namespace SGI {
         buffer += sampleRate * delay / 1000;
     }
 
-    audioData.start = newBuffer;
-    audioData.pos = newBuffer;
-    audioData.totalLength += cycleSamples * sizeof(float);
-    audioData.length = audioData.totalLength;
-
-    return true;
+    return _instance->_publish(id, std::move(sample));
   }
 
   bool AudioPlayer::bufferAddMusic(const std::string& id, const std::string& music)
@@ -286,13 +499,11 @@ namespace SGI {
     float quaterNodeDuration = 60000.0f / tempo;  // Duration of a quarter note in ms
     float multiplier = 7.0f / 8.0f; // Default duration multiplier (MN)
     
-    auto it = _instance->_audioDataMap.find(id);
-    if (it == _instance->_audioDataMap.end()) {
+    if (!_instance->_getClip(id)) {
       ERROR(AUDIOPLAYER, "Buffer ID %s not found", id.c_str());
       return false;
     }
-    AudioData& audioData = it->second;
-    
+
     for (size_t i = 0; i < music.length(); ++i) {
       char command = music[i];
 
@@ -371,14 +582,77 @@ namespace SGI {
     return true;
   }
 
-  void AudioPlayer::play(const std::string& id, bool repeating)
+  AudioPlayer::VoiceHandle AudioPlayer::play(const std::string& id, bool repeating)
   {
     initialize();
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      it->second.playing = true;
-      it->second.repeating = repeating;
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return 0;
+    }
+    Stream* stream = clip->sample->stream.get();
+
+    // Continue from where it was paused
+    VoiceHandle resumed = 0;
+    for (int voice : _instance->_getVoices(clip)) {
+      Instance& instance = _instance->_instances[voice];
+      if (instance.paused) {
+        instance.paused = false;
+        instance.repeating = repeating;
+        _instance->_send({Command::Resume, voice, nullptr, instance.sequence, 0.0f, repeating});
+        if (!resumed) {
+          resumed = makeHandle(voice, instance.sequence);
+        }
+      }
+    }
+    if (resumed) {
+      if (stream) {
+        stream->repeating.store(repeating, std::memory_order_relaxed);
+      }
+      return resumed;
+    }
+
+    int voice = _instance->_allocateVoice(*clip);
+    if (voice < 0) {
+      return 0;
+    }
+
+    if (++_instance->_sequence == 0) {
+      ++_instance->_sequence;
+    }
+    Instance& instance = _instance->_instances[voice];
+    instance.clip = clip;
+    instance.sequence = _instance->_sequence;
+    instance.started = ++_instance->_started;
+    instance.paused = false;
+    instance.repeating = repeating;
+
+    Command command = {Command::Play, voice, clip->sample.get(), instance.sequence, clip->gain, repeating};
+    command.pan = clip->pan;
+    if (stream) {
+      stream->repeating.store(repeating, std::memory_order_relaxed);
+      command.serial = _instance->_requestSeek(*stream, 0);
+    }
+
+    if (!_instance->_send(command)) {
+      instance.clip = nullptr;
+      instance.sequence = 0;
+      return 0;
+    }
+    return makeHandle(voice, instance.sequence);
+  }
+
+  void AudioPlayer::mix(Uint8* buffer, int length)
+  {
+    initialize();
+
+    // The callback runs with the stream locked
+    if (_instance->_stream) {
+      SDL_LockAudioStream(_instance->_stream);
+    }
+    _instance->_mix(buffer, length);
+    if (_instance->_stream) {
+      SDL_UnlockAudioStream(_instance->_stream);
     }
   }
 
@@ -386,9 +660,63 @@ namespace SGI {
   {
     initialize();
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      it->second.playing = false;
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    for (int voice : _instance->_getVoices(clip)) {
+      pause(makeHandle(voice, _instance->_instances[voice].sequence));
+    }
+  }
+
+  void AudioPlayer::pause(VoiceHandle handle)
+  {
+    initialize();
+
+    int voice = _instance->_getVoice(handle);
+    if (voice >= 0 && !_instance->_instances[voice].paused) {
+      Instance& instance = _instance->_instances[voice];
+      instance.paused = true;
+      _instance->_send({Command::Pause, voice, nullptr, instance.sequence, 0.0f, false});
+    }
+  }
+
+  void AudioPlayer::resume(VoiceHandle handle)
+  {
+    initialize();
+
+    int voice = _instance->_getVoice(handle);
+    if (voice >= 0 && _instance->_instances[voice].paused) {
+      Instance& instance = _instance->_instances[voice];
+      instance.paused = false;
+      _instance->_send({Command::Resume, voice, nullptr, instance.sequence, 0.0f, instance.repeating});
+    }
+  }
+
+  void AudioPlayer::seek(const std::string& id, double seconds)
+  {
+    initialize();
+
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    std::vector<int> voices = _instance->_getVoices(clip);
+    if (voices.empty()) {
+      return;
+    }
+
+    Uint64 frame = static_cast<Uint64>(std::max(seconds, 0.0) * _instance->_obtainedSpec.freq);
+    Command command = {Command::Seek, 0, nullptr, 0, 0.0f, false};
+    Stream* stream = clip->sample->stream.get();
+    if (stream) {
+      command.serial = _instance->_requestSeek(*stream, frame);
+    } else {
+      command.position = static_cast<Uint32>(std::min<Uint64>(frame * FRAME_SIZE, clip->sample->length));
+    }
+    for (int voice : voices) {
+      command.voice = voice;
+      _instance->_send(command);
     }
   }
 
@@ -396,11 +724,85 @@ namespace SGI {
   {
     initialize();
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      it->second.playing = false;
-      it->second.pos = it->second.start;
-      it->second.length = it->second.totalLength;
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    for (int voice : _instance->_getVoices(clip)) {
+      _instance->_stopVoice(voice);
+    }
+  }
+
+  void AudioPlayer::stop(VoiceHandle handle)
+  {
+    initialize();
+
+    int voice = _instance->_getVoice(handle);
+    if (voice >= 0) {
+      _instance->_stopVoice(voice);
+    }
+  }
+
+  void AudioPlayer::setGain(const std::string& id, float gain)
+  {
+    initialize();
+
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    clip->gain = gain;
+    for (int voice : _instance->_getVoices(clip)) {
+      _instance->_send({Command::SetGain, voice, nullptr, 0, gain, false});
+    }
+  }
+
+  void AudioPlayer::setGain(VoiceHandle handle, float gain)
+  {
+    initialize();
+
+    int voice = _instance->_getVoice(handle);
+    if (voice >= 0) {
+      _instance->_send({Command::SetGain, voice, nullptr, 0, gain, false});
+    }
+  }
+
+  void AudioPlayer::setMaxInstances(const std::string& id, int count, Steal steal)
+  {
+    initialize();
+
+    Clip* clip = _instance->_getClip(id);
+    if (clip) {
+      clip->maxInstances = std::max(count, 0);
+      clip->steal = steal;
+    }
+  }
+
+  void AudioPlayer::setPan(const std::string& id, float pan)
+  {
+    initialize();
+
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    clip->pan = std::min(std::max(pan, -1.0f), 1.0f);
+    for (int voice : _instance->_getVoices(clip)) {
+      Command command = {Command::SetPan, voice, nullptr, 0, 0.0f, false};
+      command.pan = clip->pan;
+      _instance->_send(command);
+    }
+  }
+
+  void AudioPlayer::setPan(VoiceHandle handle, float pan)
+  {
+    initialize();
+
+    int voice = _instance->_getVoice(handle);
+    if (voice >= 0) {
+      Command command = {Command::SetPan, voice, nullptr, 0, 0.0f, false};
+      command.pan = std::min(std::max(pan, -1.0f), 1.0f);
+      _instance->_send(command);
     }
   }
 
@@ -408,9 +810,16 @@ namespace SGI {
   {
     initialize();
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      it->second.repeating = value;
+    Clip* clip = _instance->_getClip(id);
+    if (!clip) {
+      return;
+    }
+    if (clip->sample->stream) {
+      clip->sample->stream->repeating.store(value, std::memory_order_relaxed);
+    }
+    for (int voice : _instance->_getVoices(clip)) {
+      _instance->_instances[voice].repeating = value;
+      _instance->_send({Command::SetRepeating, voice, nullptr, 0, 0.0f, value});
     }
   }
 
@@ -428,42 +837,505 @@ namespace SGI {
   {
     initialize();
 
-    auto it = _instance->_audioDataMap.find(id);
-    if (it != _instance->_audioDataMap.end()) {
-      SDL_free(it->second.start);
-      _instance->_audioDataMap.erase(it);
-      LOG(AUDIOPLAYER, "Unloaded audio with id %s", id.c_str());
+    auto it = _instance->_clips.find(id);
+    if (it == _instance->_clips.end()) {
+      return;
+    }
+
+    Clip& clip = it->second;
+    bool sent = true;
+    for (int voice : _instance->_getVoices(&clip)) {
+      sent = _instance->_stopVoice(voice) && sent;
+    }
+    for (Instance& instance : _instance->_instances) {
+      if (instance.clip == &clip) {
+        instance.clip = nullptr;
+      }
+    }
+
+    if (sent) {
+      _instance->_retire(std::move(clip.sample));
+    } else {
+      // The audio thread may still be playing it, so it can never be freed
+      clip.sample.release();
+    }
+    _instance->_clips.erase(it);
+    LOG(AUDIOPLAYER, "Unloaded audio with id %s", id.c_str());
+  }
+
+  void AudioPlayer::update()
+  {
+    // Nothing to free if no sound was ever used
+    if (_instance) {
+      _instance->_collect();
     }
   }
 
+  bool AudioPlayer::_decode(const std::string& path, const std::string& filename, Sample& sample)
+  {
+    SDL_IOStream* fio = Bundle::openResource(path, filename);
+    if (!fio) {
+      ERROR(AUDIOPLAYER, "Could not open file %s: %s", (path + filename).c_str(), SDL_GetError());
+      return false;
+    }
+    
+    std::string magic = readMagic(fio);
+
+    if (magic == "RIFF") {
+      SDL_AudioSpec fileSpec;
+      Uint8* fileBuffer;
+      Uint32 fileLength;
+
+      if (!SDL_LoadWAV_IO(fio, SDL_TRUE, &fileSpec, &fileBuffer, &fileLength)) {
+        ERROR(AUDIOPLAYER, "Failed to load WAV file %s: %s", filename.c_str(), SDL_GetError());
+        return false;
+      }
+      LOG(AUDIOPLAYER, "Loaded %s (%d len), freq: %d chan: %d format: 0x%X", filename.c_str(), fileLength, fileSpec.freq, fileSpec.channels, fileSpec.format);
+
+      Uint8* wavBuffer;
+      int wavLength;
+
+      SDL_ConvertAudioSamples(&fileSpec, fileBuffer, fileLength, &_instance->_obtainedSpec, &wavBuffer, &wavLength);
+      SDL_free(fileBuffer);
+
+      sample.data = wavBuffer;
+      sample.length = wavLength;
+      return true;
+    }
+
+    std::unique_ptr<AudioDecoder> decoder = AudioDecoder::open(fio, magic, filename);
+    if (!decoder) {
+      return false;
+    }
+
+    // Convert as it is decoded instead of holding the whole file twice
+    SDL_AudioStream* converter = SDL_CreateAudioStream(&decoder->spec, &_instance->_obtainedSpec);
+    if (!converter) {
+      ERROR(AUDIOPLAYER, "Failed to convert audio format %s: %s", filename.c_str(), SDL_GetError());
+      return false;
+    }
+
+    Uint8 block[DECODE_BLOCK_SIZE];
+    int length;
+    while ((length = decoder->read(block, sizeof(block))) > 0) {
+      SDL_PutAudioStreamData(converter, block, length);
+    }
+    SDL_FlushAudioStream(converter);
+
+    int available = SDL_GetAudioStreamAvailable(converter);
+    sample.data = static_cast<Uint8*>(SDL_malloc(available > 0 ? available : 1));
+    sample.length = sample.data ? SDL_GetAudioStreamData(converter, sample.data, available) : 0;
+    SDL_DestroyAudioStream(converter);
+    if (!sample.data) {
+      ERROR(AUDIOPLAYER, "Failed to allocate memory for %s", filename.c_str());
+      return false;
+    }
+
+    LOG(AUDIOPLAYER, "Loaded %s (%d len), freq: %d chan: %d format: 0x%X", filename.c_str(), sample.length, decoder->spec.freq, decoder->spec.channels, decoder->spec.format);
+    return true;
+  }
+
   void AudioPlayer::_audioCallback(void *userdata, SDL_AudioStream *astream, int additional_amount, int total_amount)
   {
-    Uint8* mixBuffer = new Uint8[total_amount];
-    SDL_memset(mixBuffer, 0, total_amount);
+    AudioPlayer* player = static_cast<AudioPlayer*>(userdata);
+    Uint8* mixBuffer = player->_mixBuffer.data();
+
+    while (additional_amount > 0) {
+      int length = std::min(additional_amount, static_cast<int>(player->_mixBuffer.size()));
+      SDL_memset(mixBuffer, 0, length);
+      player->_mix(mixBuffer, length);
+
+      if (!SDL_PutAudioStreamData(astream, mixBuffer, length)) {
+        ERROR(AUDIOPLAYER, "Failed to put audio stream data: %s", SDL_GetError());
+        return;
+      }
+      additional_amount -= length;
+    }
+  }
+
+  void AudioPlayer::_fillStream(Stream& stream)
+  {
+    Uint32 requested = stream.requested.load(std::memory_order_acquire);
+    if (requested != stream.applied.load(std::memory_order_relaxed)) {
+      stream.decoder->seek(stream.seekFrame.load(std::memory_order_relaxed));
+      SDL_ClearAudioStream(stream.converter);
+      stream.ended = false;
+
+      // Everything already written is from before the seek
+      stream.end.store(SIZE_MAX, std::memory_order_relaxed);
+      stream.discard.store(stream.write.load(std::memory_order_relaxed), std::memory_order_release);
+      stream.applied.store(requested, std::memory_order_release);
+    }
+
+    Uint8 block[DECODE_BLOCK_SIZE];
+    size_t write = stream.write.load(std::memory_order_relaxed);
+    bool rewound = false;
+    while (true) {
+      size_t space = STREAM_BUFFER_SIZE - (write - stream.read.load(std::memory_order_acquire));
+      if (space == 0) {
+        break;
+      }
 
-    for (auto& entry : _instance->_audioDataMap) {
-      AudioData& audioData = entry.second;
-      if (!audioData.playing || audioData.length == 0) {
+      if (SDL_GetAudioStreamAvailable(stream.converter) <= 0) {
+        if (stream.ended) {
+          break;
+        }
+
+        int length = stream.decoder->read(block, sizeof(block));
+        if (length > 0) {
+          SDL_PutAudioStreamData(stream.converter, block, length);
+          rewound = false;
+        } else if (stream.repeating.load(std::memory_order_relaxed) && !rewound && stream.decoder->seek(0)) {
+          // Carry on from the start without a gap
+          rewound = true;
+        } else {
+          stream.ended = true;
+          SDL_FlushAudioStream(stream.converter);
+        }
         continue;
       }
 
-      Uint32 length = (total_amount > audioData.length) ? audioData.length : total_amount;
-      SDL_MixAudio(mixBuffer, audioData.pos, SDL_AUDIO_F32, length, 1.0);
+      int count = SDL_GetAudioStreamData(stream.converter, block, static_cast<int>(std::min(space, sizeof(block))));
+      if (count <= 0) {
+        break;
+      }
+
+      size_t offset = write & (STREAM_BUFFER_SIZE - 1);
+      size_t first = std::min(static_cast<size_t>(count), STREAM_BUFFER_SIZE - offset);
+      SDL_memcpy(stream.ring.get() + offset, block, first);
+      SDL_memcpy(stream.ring.get(), block + first, count - first);
+      write += count;
+      stream.write.store(write, std::memory_order_release);
+    }
+
+    if (stream.ended && SDL_GetAudioStreamAvailable(stream.converter) <= 0) {
+      stream.end.store(write, std::memory_order_release);
+    }
+  }
+
+  void AudioPlayer::_streamLoop()
+  {
+    std::unique_lock<std::mutex> lock(_streamMutex);
+    while (_streaming) {
+      for (Stream* stream : _streams) {
+        _fillStream(*stream);
+      }
+      _streamCondition.wait_for(lock, std::chrono::milliseconds(STREAM_FILL_INTERVAL));
+    }
+  }
+
+  void AudioPlayer::_collect()
+  {
+    if (_retired.empty()) {
+      return;
+    }
+
+    Uint64 processed = _processed.load(std::memory_order_acquire);
+    _retired.erase(std::remove_if(_retired.begin(), _retired.end(), [processed](const std::pair<Uint64, std::unique_ptr<Sample>>& retired) {
+      return retired.first <= processed;
+    }), _retired.end());
+  }
+
+  int AudioPlayer::_allocateVoice(Clip& clip)
+  {
+    // A stream has one decoder, so it only plays once at a time
+    bool streamed = clip.sample->stream != nullptr;
+    int limit = streamed ? 1 : clip.maxInstances;
+    Steal steal = streamed ? Steal::Oldest : clip.steal;
+
+    std::vector<int> voices = _getVoices(&clip);
+    if (limit > 0 && static_cast<int>(voices.size()) >= limit) {
+      if (steal == Steal::None) {
+        return -1;
+      }
+      return *std::min_element(voices.begin(), voices.end(), [this](int a, int b) {
+        return _instances[a].started < _instances[b].started;
+      });
+    }
+
+    for (int voice = 0; voice < MAX_VOICES; ++voice) {
+      if (!_isActive(voice)) {
+        return voice;
+      }
+    }
+    if (steal == Steal::None) {
+      return -1;
+    }
+
+    // Every voice is in use, take the oldest one, sparing repeating sounds if possible
+    int oldest = 0;
+    for (int voice = 1; voice < MAX_VOICES; ++voice) {
+      const Instance& instance = _instances[voice];
+      const Instance& current = _instances[oldest];
+      if (instance.repeating != current.repeating ? current.repeating : instance.started < current.started) {
+        oldest = voice;
+      }
+    }
+    LOG(AUDIOPLAYER, "All %d voices are in use, stealing voice %d", MAX_VOICES, oldest);
+    return oldest;
+  }
 
-      audioData.pos += length;
-      audioData.length -= length;
+  AudioPlayer::Clip* AudioPlayer::_getClip(const std::string& id)
+  {
+    auto it = _clips.find(id);
+    if (it == _clips.end()) {
+      return nullptr;
+    }
+    return &it->second;
+  }
 
-      if (audioData.length == 0 && audioData.repeating) {
-        audioData.pos = audioData.start;
-        audioData.length = audioData.totalLength;
+  int AudioPlayer::_getVoice(VoiceHandle handle)
+  {
+    Uint32 voice = static_cast<Uint32>(handle);
+    Uint32 sequence = static_cast<Uint32>(handle >> 32);
+    if (voice >= MAX_VOICES || sequence == 0 || _instances[voice].sequence != sequence || !_isActive(voice)) {
+      return -1;
+    }
+    return voice;
+  }
+
+  std::vector<int> AudioPlayer::_getVoices(const Clip* clip)
+  {
+    std::vector<int> voices;
+    for (int voice = 0; voice < MAX_VOICES; ++voice) {
+      if (_instances[voice].clip == clip && _isActive(voice)) {
+        voices.push_back(voice);
       }
     }
+    return voices;
+  }
+
+  bool AudioPlayer::_isActive(int voice)
+  {
+    Uint32 sequence = _instances[voice].sequence;
+    return sequence != 0 && _voices[voice].finished.load(std::memory_order_acquire) != sequence;
+  }
 
-    if (!SDL_PutAudioStreamData(astream, mixBuffer, additional_amount)) {
-      ERROR(AUDIOPLAYER, "Failed to put audio stream data: %s", SDL_GetError());
+  void AudioPlayer::_mix(Uint8* buffer, int length)
+  {
+    Command command;
+    Uint64 processed = 0;
+    while (_commands.pop(command)) {
+      ++processed;
+      Voice& voice = _voices[command.voice];
+      switch (command.type) {
+        case Command::Play:
+          voice.sample = command.sample;
+          voice.position = 0;
+          voice.sequence = command.sequence;
+          voice.serial = command.serial;
+          voice.playing = true;
+          voice.repeating = command.repeating;
+          voice.gain = command.gain;
+          voice.pan = command.pan;
+
+          // A new play starts at full level instead of ramping up
+          getChannelGains(voice.gain, voice.pan, voice.left, voice.right);
+          break;
+        case Command::Resume:
+          if (voice.sequence == command.sequence) {
+            voice.playing = true;
+            voice.repeating = command.repeating;
+          }
+          break;
+        case Command::Pause:
+          voice.playing = false;
+          break;
+        case Command::Stop:
+          voice.sample = nullptr;
+          voice.playing = false;
+          voice.position = 0;
+          voice.finished.store(voice.sequence, std::memory_order_release);
+          break;
+        case Command::SetGain:
+          voice.gain = command.gain;
+          break;
+        case Command::SetPan:
+          voice.pan = command.pan;
+          break;
+        case Command::SetRepeating:
+          voice.repeating = command.repeating;
+          break;
+        case Command::SetSample:
+          // Only if it hasn't finished since the command was sent
+          if (voice.sample) {
+            voice.sample = command.sample;
+            voice.position = std::min(voice.position, voice.sample->length);
+          }
+          break;
+        case Command::Seek:
+          voice.position = std::min(command.position, voice.sample ? voice.sample->length : 0);
+          voice.serial = command.serial;
+          break;
+      }
     }
 
-    delete[] mixBuffer;
+    int frames = length / FRAME_SIZE;
+    for (Voice& voice : _voices) {
+      bool streaming = voice.sample && voice.sample->stream;
+      if (!voice.playing && !streaming) {
+        continue;
+      }
+
+      // Ramp over the block toward the gains asked for
+      float left, right;
+      getChannelGains(voice.gain, voice.pan, left, right);
+      voice.leftStep = frames > 0 ? (left - voice.left) / frames : 0.0f;
+      voice.rightStep = frames > 0 ? (right - voice.right) / frames : 0.0f;
+
+      if (streaming) {
+        _mixStream(voice, *voice.sample->stream, buffer, length);
+      } else {
+        _mixSample(voice, buffer, length);
+      }
+
+      // Land exactly on the gains, however much of the block was played
+      voice.left = left;
+      voice.right = right;
+    }
+
+    MixKernel::softClip(reinterpret_cast<float*>(buffer), length / sizeof(float));
+
+    // Samples replaced before these commands are no longer used
+    _processed.fetch_add(processed, std::memory_order_release);
+  }
+
+  void AudioPlayer::_mixSample(Voice& voice, Uint8* buffer, int length)
+  {
+    const Sample* sample = voice.sample;
+    Uint32 offset = 0;
+    while (offset < static_cast<Uint32>(length)) {
+      // A partial frame at the end is dropped
+      Uint32 remaining = sample ? (sample->length - voice.position) / FRAME_SIZE * FRAME_SIZE : 0;
+      if (remaining == 0) {
+        if (voice.repeating && sample && sample->length >= FRAME_SIZE) {
+          voice.position = 0;
+          continue;
+        }
+        voice.sample = nullptr;
+        voice.playing = false;
+        voice.finished.store(voice.sequence, std::memory_order_release);
+        break;
+      }
+
+      Uint32 mixLength = std::min(remaining, length - offset);
+      _mixVoice(voice, buffer + offset, sample->data + voice.position, mixLength);
+      voice.position += mixLength;
+      offset += mixLength;
+    }
+  }
+
+  void AudioPlayer::_mixStream(Voice& voice, Stream& stream, Uint8* buffer, int length)
+  {
+    // Applied is stored after discard, so loading it first makes discard at least as new
+    Uint32 applied = stream.applied.load(std::memory_order_acquire);
+
+    // Skip what was decoded before a seek, even while paused, so the ring doesn't stay full of it
+    size_t read = std::max(stream.read.load(std::memory_order_relaxed), stream.discard.load(std::memory_order_acquire));
+
+    // Wait for the decoder thread to reach the position the voice plays from
+    if (voice.playing && applied == voice.serial) {
+      size_t available = stream.write.load(std::memory_order_acquire) - read;
+      size_t count = std::min(available, static_cast<size_t>(length));
+      size_t offset = read & (STREAM_BUFFER_SIZE - 1);
+      size_t first = std::min(count, STREAM_BUFFER_SIZE - offset);
+
+      // Anything short of length is an underrun and stays silent
+      _mixVoice(voice, buffer, stream.ring.get() + offset, first);
+      if (count > first) {
+        _mixVoice(voice, buffer + first, stream.ring.get(), count - first);
+      }
+      read += count;
+
+      if (read == stream.end.load(std::memory_order_acquire)) {
+        voice.sample = nullptr;
+        voice.playing = false;
+        voice.finished.store(voice.sequence, std::memory_order_release);
+      }
+    }
+
+    stream.read.store(read, std::memory_order_release);
+  }
+
+  void AudioPlayer::_mixVoice(Voice& voice, Uint8* output, const Uint8* input, Uint32 length)
+  {
+    int frames = length / FRAME_SIZE;
+    MixKernel::mix(reinterpret_cast<float*>(output), reinterpret_cast<const float*>(input), frames, voice.left, voice.right, voice.leftStep, voice.rightStep);
+    voice.left += voice.leftStep * frames;
+    voice.right += voice.rightStep * frames;
+  }
+
+  bool AudioPlayer::_publish(const std::string& id, std::unique_ptr<Sample> sample)
+  {
+    Clip* clip = _getClip(id);
+    if (!clip) {
+      clip = &_clips[id];
+    }
+
+    if (clip->sample) {
+      // A stream can't be swapped for another sound where it is, so it is stopped
+      bool streamed = clip->sample->stream || sample->stream;
+      bool sent = true;
+      for (int voice : _getVoices(clip)) {
+        if (streamed) {
+          sent = _stopVoice(voice) && sent;
+        } else {
+          sent = _send({Command::SetSample, voice, sample.get(), 0, 0.0f, false}) && sent;
+        }
+      }
+
+      if (sent) {
+        _retire(std::move(clip->sample));
+      } else {
+        // The audio thread may still be playing it, so it can never be freed
+        clip->sample.release();
+      }
+    }
+    clip->sample = std::move(sample);
+    return true;
+  }
+
+  Uint32 AudioPlayer::_requestSeek(Stream& stream, Uint64 frame)
+  {
+    stream.seekFrame.store(frame, std::memory_order_relaxed);
+    Uint32 serial = stream.requested.load(std::memory_order_relaxed) + 1;
+    stream.requested.store(serial, std::memory_order_release);
+    _streamCondition.notify_one();
+    return serial;
+  }
+
+  void AudioPlayer::_retire(std::unique_ptr<Sample> sample)
+  {
+    if (sample->stream) {
+      std::lock_guard<std::mutex> lock(_streamMutex);
+      _streams.erase(std::remove(_streams.begin(), _streams.end(), sample->stream.get()), _streams.end());
+    }
+    _retired.emplace_back(_sent, std::move(sample));
+    _collect();
+  }
+
+  bool AudioPlayer::_send(const Command& command)
+  {
+    // The audio thread empties the queue every callback, so a full queue is only waited on briefly
+    for (int attempt = 0; !_commands.push(command); ++attempt) {
+      if (!_stream || attempt == SEND_ATTEMPTS) {
+        ERROR(AUDIOPLAYER, "Audio command queue is full");
+        return false;
+      }
+      SDL_Delay(1);
+    }
+    ++_sent;
+    _collect();
+    return true;
+  }
+
+  bool AudioPlayer::_stopVoice(int voice)
+  {
+    Instance& instance = _instances[voice];
+    instance.clip = nullptr;
+    instance.sequence = 0;
+    instance.paused = false;
+    return _send({Command::Stop, voice, nullptr, 0, 0.0f, false});
   }
 
   float AudioPlayer::_getNoteFrequency(char note, int octave, bool sharp, bool flat)
@@ -0,0 +1,382 @@
+#include <algorithm>
+#include <cstring>
+#include <SDL3/SDL.h>
+#include <string_view>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "bundle.h"
+#include "debug.h"
+
+namespace SGI {
+  std::mutex Bundle::_mountMutex;
+  std::vector<std::shared_ptr<Bundle>> Bundle::_mounted;
+
+  static const int LZ_HASH_BITS = 16;
+  static const size_t LZ_MAX_OFFSET = 65535;
+  static const size_t LZ_MIN_MATCH = 4;
+
+  static Uint32 read32(const Uint8* data)
+  {
+    Uint32 value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  static void writeLength(std::vector<Uint8>& out, size_t length)
+  {
+    while (length >= 255) {
+      out.push_back(255);
+      length -= 255;
+    }
+    out.push_back(static_cast<Uint8>(length));
+  }
+
+  static bool readLength(const Uint8*& ip, const Uint8* end, size_t& length)
+  {
+    Uint8 byte;
+    do {
+      if (ip >= end) {
+        return false;
+      }
+      byte = *ip++;
+      length += byte;
+    } while (byte == 255);
+    return true;
+  }
+
+  /**
+   * Writes a run of literals followed by an optional match
+   *
+   * The token's high nibble is the literal count and its low nibble is
+   * the match length minus the minimum, 15 means more length follows.
+   */
+  static void writeSequence(std::vector<Uint8>& out, const Uint8* literals, size_t literalCount, size_t offset, size_t matchLength)
+  {
+    size_t match = matchLength > 0 ? matchLength - LZ_MIN_MATCH : 0;
+    Uint8 token = static_cast<Uint8>((std::min<size_t>(literalCount, 15) << 4) | std::min<size_t>(match, 15));
+    out.push_back(token);
+    if (literalCount >= 15) {
+      writeLength(out, literalCount - 15);
+    }
+    out.insert(out.end(), literals, literals + literalCount);
+
+    if (matchLength > 0) {
+      out.push_back(static_cast<Uint8>(offset & 0xFF));
+      out.push_back(static_cast<Uint8>(offset >> 8));
+      if (match >= 15) {
+        writeLength(out, match - 15);
+      }
+    }
+  }
+
+  Bundle::~Bundle()
+  {
+    if (_mapping) {
+#ifdef _WIN32
+      UnmapViewOfFile(_mapping);
+#else
+      munmap(_mapping, _size);
+#endif
+    }
+    if (_loaded) {
+      SDL_free(_loaded);
+    }
+  }
+
+  std::shared_ptr<Bundle> Bundle::open(const std::string& fileName)
+  {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    ERROR(BUNDLE, "Bundles are not supported on big endian platforms");
+    return nullptr;
+#endif
+
+    std::shared_ptr<Bundle> bundle(new Bundle());
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+      LARGE_INTEGER size;
+      HANDLE mapping = nullptr;
+      if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      }
+      if (mapping) {
+        // The view keeps the file open, so both handles can be closed
+        bundle->_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        bundle->_size = static_cast<size_t>(size.QuadPart);
+        CloseHandle(mapping);
+      }
+      CloseHandle(file);
+    }
+#else
+    int file = ::open(fileName.c_str(), O_RDONLY);
+    if (file >= 0) {
+      struct stat info;
+      if (fstat(file, &info) == 0 && info.st_size > 0) {
+        void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED) {
+          // Read ahead now, so the first use doesn't fault page by page
+          madvise(mapping, info.st_size, MADV_WILLNEED);
+          bundle->_mapping = mapping;
+          bundle->_size = static_cast<size_t>(info.st_size);
+        }
+      }
+      close(file);
+    }
+#endif
+
+    if (bundle->_mapping) {
+      bundle->_data = static_cast<const Uint8*>(bundle->_mapping);
+    } else {
+      // Fall back to one read of the whole file
+      bundle->_loaded = SDL_LoadFile(fileName.c_str(), &bundle->_size);
+      if (!bundle->_loaded) {
+        LOG(BUNDLE, "Unable to open bundle %s: %s", fileName.c_str(), SDL_GetError());
+        return nullptr;
+      }
+      bundle->_data = static_cast<const Uint8*>(bundle->_loaded);
+    }
+
+    Header header;
+    if (bundle->_size < sizeof(header)) {
+      ERROR(BUNDLE, "Bundle %s is truncated", fileName.c_str());
+      return nullptr;
+    }
+    memcpy(&header, bundle->_data, sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 || header.version != VERSION) {
+      ERROR(BUNDLE, "Bundle %s is not a version %u bundle", fileName.c_str(), VERSION);
+      return nullptr;
+    }
+
+    size_t tocSize = sizeof(header) + static_cast<size_t>(header.count) * sizeof(Entry);
+    if (tocSize + header.namesSize > bundle->_size) {
+      ERROR(BUNDLE, "Bundle %s is truncated", fileName.c_str());
+      return nullptr;
+    }
+
+    bundle->_count = header.count;
+    bundle->_entries = reinterpret_cast<const Entry*>(bundle->_data + sizeof(header));
+    bundle->_names = reinterpret_cast<const char*>(bundle->_data + tocSize);
+
+    for (Uint32 i = 0; i < bundle->_count; ++i) {
+      const Entry& entry = bundle->_entries[i];
+      if (entry.offset > bundle->_size || entry.storedSize > bundle->_size - entry.offset ||
+          static_cast<size_t>(entry.nameOffset) + entry.nameLength > header.namesSize ||
+          entry.compression > static_cast<Uint16>(Compression::LZ)) {
+        ERROR(BUNDLE, "Bundle %s has an invalid entry", fileName.c_str());
+        return nullptr;
+      }
+    }
+
+    LOG(BUNDLE, "Opened bundle %s with %u entries", fileName.c_str(), bundle->_count);
+    return bundle;
+  }
+
+  bool Bundle::contains(const std::string& name)
+  {
+    return _find(name) != nullptr;
+  }
+
+  const void* Bundle::getData(const std::string& name, size_t* size)
+  {
+    const Entry* entry = _find(name);
+    if (!entry) {
+      return nullptr;
+    }
+
+    if (size) {
+      *size = entry->size;
+    }
+    if (entry->compression == static_cast<Uint16>(Compression::None)) {
+      return _data + entry->offset;
+    }
+
+    Uint32 index = static_cast<Uint32>(entry - _entries);
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _decompressed.find(index);
+    if (it != _decompressed.end()) {
+      return it->second.get();
+    }
+
+    std::unique_ptr<Uint8[]> data(new Uint8[entry->size > 0 ? entry->size : 1]);
+    if (!decompress(_data + entry->offset, entry->storedSize, data.get(), entry->size)) {
+      ERROR(BUNDLE, "Entry %s is corrupt", name.c_str());
+      return nullptr;
+    }
+    const void* result = data.get();
+    _decompressed[index] = std::move(data);
+    return result;
+  }
+
+  std::vector<std::string> Bundle::getNames()
+  {
+    std::vector<std::string> names;
+    names.reserve(_count);
+    for (Uint32 i = 0; i < _count; ++i) {
+      names.emplace_back(_names + _entries[i].nameOffset, _entries[i].nameLength);
+    }
+    return names;
+  }
+
+  SDL_IOStream* Bundle::openIO(const std::string& name)
+  {
+    size_t size = 0;
+    const void* data = getData(name, &size);
+    if (!data) {
+      return nullptr;
+    }
+    return SDL_IOFromConstMem(data, size);
+  }
+
+  bool Bundle::mount(const std::string& fileName)
+  {
+    std::shared_ptr<Bundle> bundle = open(fileName);
+    if (!bundle) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_mountMutex);
+    _mounted.insert(_mounted.begin(), bundle);
+    return true;
+  }
+
+  const void* Bundle::getResource(const std::string& name, size_t* size)
+  {
+    std::vector<std::shared_ptr<Bundle>> mounted;
+    {
+      std::lock_guard<std::mutex> lock(_mountMutex);
+      mounted = _mounted;
+    }
+
+    for (const std::shared_ptr<Bundle>& bundle : mounted) {
+      const void* data = bundle->getData(name, size);
+      if (data) {
+        return data;
+      }
+    }
+    return nullptr;
+  }
+
+  SDL_IOStream* Bundle::openResource(const std::string& path, const std::string& name)
+  {
+    size_t size = 0;
+    const void* data = getResource(name, &size);
+    if (data) {
+      return SDL_IOFromConstMem(data, size);
+    }
+    return SDL_IOFromFile((path + name).c_str(), "rb");
+  }
+
+  std::vector<Uint8> Bundle::compress(const Uint8* data, size_t size)
+  {
+    std::vector<Uint8> out;
+    out.reserve(size);
+
+    // Positions are stored plus one, so 0 is empty
+    std::vector<size_t> table(1 << LZ_HASH_BITS, 0);
+    size_t anchor = 0;
+    size_t i = 0;
+    while (i + LZ_MIN_MATCH <= size) {
+      Uint32 sequence = read32(data + i);
+      Uint32 hash = (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+      size_t candidate = table[hash];
+      table[hash] = i + 1;
+
+      if (candidate > 0 && i - (candidate - 1) <= LZ_MAX_OFFSET && read32(data + candidate - 1) == sequence) {
+        size_t match = candidate - 1;
+        size_t length = LZ_MIN_MATCH;
+        while (i + length < size && data[match + length] == data[i + length]) {
+          ++length;
+        }
+        writeSequence(out, data + anchor, i - anchor, i - match, length);
+        i += length;
+        anchor = i;
+      } else {
+        ++i;
+      }
+
+      if (out.size() >= size) {
+        return {};
+      }
+    }
+    writeSequence(out, data + anchor, size - anchor, 0, 0);
+
+    if (out.size() >= size) {
+      return {};
+    }
+    return out;
+  }
+
+  bool Bundle::decompress(const Uint8* data, size_t size, Uint8* output, size_t outputSize)
+  {
+    const Uint8* ip = data;
+    const Uint8* end = data + size;
+    Uint8* op = output;
+    Uint8* outputEnd = output + outputSize;
+
+    while (ip < end) {
+      Uint8 token = *ip++;
+
+      size_t literals = token >> 4;
+      if (literals == 15 && !readLength(ip, end, literals)) {
+        return false;
+      }
+      if (literals > static_cast<size_t>(end - ip) || literals > static_cast<size_t>(outputEnd - op)) {
+        return false;
+      }
+      memcpy(op, ip, literals);
+      op += literals;
+      ip += literals;
+
+      // The last sequence only has literals
+      if (ip == end) {
+        break;
+      }
+
+      if (end - ip < 2) {
+        return false;
+      }
+      size_t offset = ip[0] | (ip[1] << 8);
+      ip += 2;
+
+      size_t length = token & 0x0F;
+      if (length == 15 && !readLength(ip, end, length)) {
+        return false;
+      }
+      length += LZ_MIN_MATCH;
+      if (offset == 0 || offset > static_cast<size_t>(op - output) || length > static_cast<size_t>(outputEnd - op)) {
+        return false;
+      }
+
+      // Matches may overlap what they write, so copy byte by byte
+      const Uint8* match = op - offset;
+      for (size_t j = 0; j < length; ++j) {
+        *op++ = *match++;
+      }
+    }
+
+    return op == outputEnd;
+  }
+
+  const Bundle::Entry* Bundle::_find(const std::string& name)
+  {
+    // The packer sorts entries by name
+    const Entry* begin = _entries;
+    const Entry* end = _entries + _count;
+    const Entry* it = std::lower_bound(begin, end, name, [this](const Entry& entry, const std::string& name) {
+      return std::string_view(_names + entry.nameOffset, entry.nameLength) < std::string_view(name);
+    });
+    if (it != end && std::string_view(_names + it->nameOffset, it->nameLength) == std::string_view(name)) {
+      return it;
+    }
+    return nullptr;
+  }
+}
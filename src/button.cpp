@@ -5,6 +5,7 @@
 #include "debug.h"
 #include "button.h"
 #include "fontbook.h"
+#include "profiler.h"
 #include "window.h"
 
 namespace SGI {
@@ -53,7 +54,7 @@ namespace SGI {
       return;
     }
 
-    _textTexture = SDL_CreateTextureFromSurface(getRenderer().get(), _textSurface.get());
+    _textTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), _textSurface.get()));
     if (!_textTexture) {
       ERROR(LABEL, "Texture not created: %s", SDL_GetError());
       return;
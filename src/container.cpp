@@ -1,11 +1,15 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include "debug.h"
 #include "container.h"
-#include "flat.h"
+#include "drawlist.h"
+#include "profiler.h"
+#include "theme.h"
 #include "widget.h"
+#include "window.h"
 
 namespace SGI {
   std::shared_ptr<Container> Container::create()
@@ -18,6 +22,16 @@ namespace SGI {
 
   Container::Container() : Widget() { };
 
+  Container::~Container()
+  {
+    // Children can outlive the container, don't leave them pointing at it
+    for (const auto& child : _children) {
+      if (child->_parent == this) {
+        child->_parent = nullptr;
+      }
+    }
+  }
+
   void Container::addChild(WidgetPtr widget)
   {
     if (widget->_root != nullptr) {
@@ -28,14 +42,14 @@ namespace SGI {
     auto it = std::find(_children.begin(), _children.end(), widget);
     if (it == _children.end()) {
       _children.push_back(widget);
+      widget->_parent = this;
       widget->_setRenderer(_renderer);
       widget->_setRoot(_root);
       LOG(CONTAINER, "Added child %s to %s", widget->getName().c_str(), getName().c_str());
       _calculateChildrenBounds();
+      _invalidate();
 
-      if (auto flatWidget = std::dynamic_pointer_cast<Flat>(widget)) {
-        flatWidget->setTheme(_themeName);
-      }
+      widget->_setTheme(_theme);
     } else {
       ERROR(WIDGET, "Can't add widget to more than one parent.");
     }
@@ -44,13 +58,22 @@ namespace SGI {
   std::vector<std::shared_ptr<Widget>> Container::find(const std::string& name) const
   {
     std::vector<std::shared_ptr<Widget>> result;
-    _findRecursive(name, result);
+    if (_root) {
+      _root->_findNamed(this, name, false, result);
+    } else {
+      _findRecursive(name, result);
+    }
     return result;
   }
 
   std::shared_ptr<Widget> Container::findFirst(const std::string& name) const
   {
-    std::vector<std::shared_ptr<Widget>> result = find(name);
+    std::vector<std::shared_ptr<Widget>> result;
+    if (_root) {
+      _root->_findNamed(this, name, true, result);
+    } else {
+      _findRecursive(name, result);
+    }
 
     if (result.empty()) {
       return nullptr;
@@ -101,16 +124,46 @@ namespace SGI {
   {
     auto it = std::find(_children.begin(), _children.end(), widget);
     if (it != _children.end()) {
+      widget->_invalidate();
+      if (_root) {
+        _root->_detachWidget(widget.get());
+      }
       _children.erase(it);
+      widget->_parent = nullptr;
       widget->_renderer = nullptr;
-      widget->_root = nullptr;
+      widget->_setRoot(nullptr);
     }
   }
 
   void Container::removeAll()
   {
+    for (const auto& child : _children) {
+      if (_root) {
+        _root->_detachWidget(child.get());
+      }
+      child->_parent = nullptr;
+      child->_setRoot(nullptr);
+    }
     _children.clear();
     _calculateChildrenBounds();
+    _invalidate();
+  }
+
+  bool Container::isCached()
+  {
+    return _cached;
+  }
+
+  void Container::setCached(bool value)
+  {
+    _cached = value;
+    _cacheValid = false;
+    if (!_cached) {
+      _cacheTexture = nullptr;
+      _cacheWidth = 0;
+      _cacheHeight = 0;
+    }
+    _invalidate();
   }
 
   void Container::setConstraint(Widget::ConstraintType constraint, int minValue, int maxValue)
@@ -209,22 +262,22 @@ namespace SGI {
 
   void Container::setTheme(const std::string& name)
   {
-    if (_name == "WindowSidebarContainer") {
-      LOG(SIDEBAR, "%s", name.c_str());
-    }
-    _themeName = name;
-    for (const auto& child : _children) {
-      if (auto flatWidget = std::dynamic_pointer_cast<Flat>(child)) {
-        flatWidget->setTheme(name);
-      }
-      if (auto containerWidget = std::dynamic_pointer_cast<Container>(child)) {
-        containerWidget->setTheme(name);
-      }
-    }
+    _setTheme(Themes::resolve(name));
   }
 
   void Container::_calculateChildrenBounds()
   {
+    // Nested containers are laid out from inside this, so only the
+    // outermost layout is timed
+    if (_root && _root->_profiling && !_root->_profilingLayout) {
+      _root->_profilingLayout = true;
+      double start = Profiler::milliseconds();
+      _calculateChildrenBounds();
+      _root->_layoutTime += Profiler::milliseconds() - start;
+      _root->_profilingLayout = false;
+      return;
+    }
+
     _updateContentArea();
 
     int numChildren = _children.size();
@@ -244,10 +297,7 @@ namespace SGI {
       minSpaceing = (numChildren - 1) * _spacing;
     }
 
-    int widthLeft = parentWidth;
-    int heightLeft = parentHeight;
-    int widthZero = 0;
-    int heightZero = 0;
+    _childRects.resize(numChildren);
     for (size_t i = 0; i < numChildren; ++i) {
       int width = _children[i]->_constraints.width.minValue;
       int height = _children[i]->_constraints.height.minValue;
@@ -261,20 +311,10 @@ namespace SGI {
         height = _children[i]->_constraints.height.preferredValue;
       }
 
-      SDL_Rect childRect;
-      childRect.x = 0;
-      childRect.y = 0;
-      childRect.w = width;
-      childRect.h = height;
-      _children[i]->_setBounds(childRect);
-      widthLeft -= childRect.w;
-      heightLeft -= childRect.h;
-      if (childRect.w == 0) {
-        widthZero += 1;
-      }
-      if (childRect.h == 0) {
-        heightZero += 1;
-      }
+      _childRects[i].x = 0;
+      _childRects[i].y = 0;
+      _childRects[i].w = width;
+      _childRects[i].h = height;
     }
     
     if (_Direction == Row) {
@@ -299,102 +339,8 @@ namespace SGI {
 
     _spacing = _spaceingConstraint.minValue;
 
-    // Children are expected to be reset already
-    int contentWidth = 0;
-    for (size_t i = 0; i < numChildren; ++i) {
-      contentWidth += _children[i]->_bounds.w;
-    }
-    if (_spaceContentType == SpaceContent::Around) {
-      contentWidth += (numChildren + 1) * _spacing;
-    } else {
-      contentWidth += (numChildren - 1) * _spacing;
-    }
-
-    std::vector<SDL_Rect> childRects;
-    for (size_t i = 0; i < numChildren; ++i) {
-      SDL_Rect childRect;
-      childRect.x = _children[i]->_bounds.x;
-      childRect.y = _children[i]->_bounds.y;
-      childRect.w = _children[i]->_bounds.w;
-      childRect.h = _children[i]->_bounds.h;
-      childRects.push_back(childRect);
-    }
-
-    int spaceLeft =  parentWidth - contentWidth;
-    bool canGrowWidth = true;
-    bool canGrowSpacing = true;
-    while (spaceLeft > 0 && (canGrowWidth || canGrowSpacing)) {
-      if (canGrowWidth) {
-        canGrowWidth = false;
-        contentWidth = 0;
-
-        int growBy = spaceLeft / numChildren;
-        if (growBy == 0 && spaceLeft > 0) {
-          growBy = 1;
-        }
-
-        for (size_t i = 0; i < numChildren; ++i) {
-          bool didGrow = false;
-          if (childRects[i].w + growBy <= _children[i]->_constraints.width.maxValue &&
-              contentWidth + childRects[i].w + growBy <= parentWidth) {
-            if (_children[i]->_constraints.width.preferredValue == -1 ||
-                childRects[i].w + growBy < _children[i]->_constraints.width.preferredValue) {
-              childRects[i].w += growBy;
-              didGrow = true;
-            }
-          } else if (childRects[i].w + growBy > _children[i]->_constraints.width.maxValue &&
-                    childRects[i].w < _children[i]->_constraints.width.maxValue &&
-                    contentWidth + _children[i]->_constraints.width.maxValue <= parentWidth) {
-            childRects[i].w = _children[i]->_constraints.width.maxValue;
-          }
-
-          contentWidth += childRects[i].w;
-          if (i != 0 || _spaceContentType == SpaceContent::Around) {
-            contentWidth += _spacing;
-          }
-
-          if (didGrow && childRects[i].w < _children[i]->_constraints.width.maxValue && contentWidth < parentWidth) {
-            canGrowWidth = true;
-          }
-        }
-
-        if (_spaceContentType == SpaceContent::Around) {
-          contentWidth += _spacing;
-        }
-      } else if (canGrowSpacing) {
-        canGrowSpacing = false;
-        contentWidth = 0;
-
-        int spaceCount = _spaceContentType == SpaceContent::Between ? (numChildren - 1) : (numChildren + 1);
-        int growBy = spaceLeft / spaceCount;
-        if (growBy == 0 && spaceLeft > 0) {
-          growBy = 1;
-        }
-
-        if (_spacing + growBy < _spaceingConstraint.maxValue) {
-          _spacing += growBy;
-        } else if (_spacing < _spaceingConstraint.maxValue) {
-          _spacing = _spaceingConstraint.maxValue;
-        }
-
-        for (size_t i = 0; i < numChildren; ++i) {
-          contentWidth += childRects[i].w;
-          if (i != 0 || _spaceContentType == SpaceContent::Around) {
-            contentWidth += _spacing;
-          }
-        }
-
-        if (_spaceContentType == SpaceContent::Around) {
-          contentWidth += _spacing;
-        }
-
-        if (_spacing < _spaceingConstraint.maxValue && contentWidth < parentWidth && spaceCount > 0) {
-          canGrowSpacing = true;
-        }
-      }
-
-      spaceLeft = parentWidth - contentWidth;
-    }
+    std::vector<SDL_Rect>& childRects = _childRects;
+    int spaceLeft = _distributeSpace(parentWidth, true);
 
     for (size_t i = 0; i < numChildren; ++i) {
       float preferred = _children[i]->_constraints.height.preferredValue == -1 ? _children[i]->_constraints.height.maxValue : _children[i]->_constraints.height.preferredValue;
@@ -429,102 +375,8 @@ namespace SGI {
 
     _spacing = _spaceingConstraint.minValue;
 
-    // Children are expected to be reset already
-    unsigned int contentHeight = 0;
-    for (size_t i = 0; i < numChildren; ++i) {
-      contentHeight += _children[i]->_bounds.h;
-    }
-    if (_spaceContentType == SpaceContent::Around) {
-      contentHeight += (numChildren + 1) * _spacing;
-    } else {
-      contentHeight += (numChildren - 1) * _spacing;
-    }
-
-    std::vector<SDL_Rect> childRects;
-    for (size_t i = 0; i < numChildren; ++i) {
-      SDL_Rect childRect;
-      childRect.x = _children[i]->_bounds.x;
-      childRect.y = _children[i]->_bounds.y;
-      childRect.w = _children[i]->_bounds.w;
-      childRect.h = _children[i]->_bounds.h;
-      childRects.push_back(childRect);
-    }
-
-    int spaceLeft = parentHeight - contentHeight;
-    bool canGrowHeight = true;
-    bool canGrowSpacing = true;
-    while (spaceLeft > 0 && (canGrowHeight || canGrowSpacing)) {
-      if (canGrowHeight) {
-        canGrowHeight = false;
-        contentHeight = 0;
-
-        int growBy = spaceLeft / numChildren;
-        if (growBy == 0 && spaceLeft > 0) {
-          growBy = 1;
-        }
-
-        for (size_t i = 0; i < numChildren; ++i) {
-          bool didGrow = false;
-          if (childRects[i].h + growBy <= _children[i]->_constraints.height.maxValue &&
-              contentHeight + childRects[i].h + growBy <= parentHeight) {
-            if (_children[i]->_constraints.height.preferredValue == -1 ||
-                childRects[i].h + growBy < _children[i]->_constraints.height.preferredValue) {
-              childRects[i].h += growBy;
-              didGrow = true;
-            }
-          } else if (childRects[i].h + growBy > _children[i]->_constraints.height.maxValue &&
-                     childRects[i].h < _children[i]->_constraints.height.maxValue &&
-                     contentHeight + childRects[i].h + _children[i]->_constraints.height.maxValue <= parentHeight) {
-            childRects[i].h = _children[i]->_constraints.height.maxValue;
-          }
-
-          contentHeight += childRects[i].h;
-          if (i != 0 || _spaceContentType == SpaceContent::Around) {
-            contentHeight += _spacing;
-          }
-
-          if (didGrow && childRects[i].h < _children[i]->_constraints.height.maxValue && contentHeight < parentHeight) {
-            canGrowHeight = true;
-          }
-        }
-
-        if (_spaceContentType == SpaceContent::Around) {
-          contentHeight += _spacing;
-        }
-      } else if (canGrowSpacing) {
-        canGrowSpacing = false;
-        contentHeight = 0;
-
-        int spaceCount = _spaceContentType == SpaceContent::Between ? (numChildren - 1) : (numChildren + 1);
-        int growBy = spaceLeft / spaceCount;
-        if (growBy == 0 && spaceLeft > 0) {
-          growBy = 1;
-        }
-
-        if (_spacing + growBy < _spaceingConstraint.maxValue) {
-          _spacing += growBy;
-        } else if (_spacing < _spaceingConstraint.maxValue) {
-          _spacing = _spaceingConstraint.maxValue;
-        }
-
-        for (size_t i = 0; i < numChildren; ++i) {
-          contentHeight += childRects[i].h;
-          if (i != 0 || _spaceContentType == SpaceContent::Around) {
-            contentHeight += _spacing;
-          }
-        }
-
-        if (_spaceContentType == SpaceContent::Around) {
-          contentHeight += _spacing;
-        }
-
-        if (_spacing < _spaceingConstraint.maxValue && contentHeight < parentHeight && spaceCount > 0) {
-          canGrowSpacing = true;
-        }
-      }
-
-      spaceLeft = parentHeight - contentHeight;
-    }
+    std::vector<SDL_Rect>& childRects = _childRects;
+    int spaceLeft = _distributeSpace(parentHeight, false);
 
     for (size_t i = 0; i < numChildren; ++i) {
       int preferred = _children[i]->_constraints.width.preferredValue == -1 ? _children[i]->_constraints.width.maxValue : _children[i]->_constraints.width.preferredValue;
@@ -559,6 +411,77 @@ namespace SGI {
     return 0;
   }
 
+  int Container::_distributeSpace(int available, bool horizontal)
+  {
+    int numChildren = _children.size();
+    int spaceCount = _spaceContentType == SpaceContent::Around ? (numChildren + 1) : (numChildren - 1);
+
+    // Children are expected to be reset already
+    long long contentSize = (long long)spaceCount * _spacing;
+    for (size_t i = 0; i < numChildren; ++i) {
+      contentSize += horizontal ? _childRects[i].w : _childRects[i].h;
+    }
+
+    long long spaceLeft = available - contentSize;
+    if (spaceLeft <= 0) {
+      return spaceLeft;
+    }
+
+    // How far each child can grow. A child with a preferred size grows
+    // up to it, any other child up to its maximum.
+    _childRoom.resize(numChildren);
+    for (size_t i = 0; i < numChildren; ++i) {
+      const Constraint& constraint = horizontal ? _children[i]->_constraints.width : _children[i]->_constraints.height;
+      int size = horizontal ? _childRects[i].w : _childRects[i].h;
+      int limit = constraint.maxValue;
+      if (constraint.preferredValue != -1) {
+        limit = std::max(constraint.minValue, std::min(constraint.preferredValue, constraint.maxValue));
+      }
+      _childRoom[i] = std::max(0, limit - size);
+    }
+
+    // Every child grows by the same amount until it hits its limit, so
+    // walking the limits in order finds the largest amount that fits
+    _childRoomSorted = _childRoom;
+    std::sort(_childRoomSorted.begin(), _childRoomSorted.end());
+
+    long long growBy = 0;
+    for (size_t i = 0; i < numChildren && spaceLeft > 0; ++i) {
+      long long growing = numChildren - i;
+      long long step = _childRoomSorted[i] - growBy;
+      if (step * growing > spaceLeft) {
+        growBy += spaceLeft / growing;
+        spaceLeft -= (spaceLeft / growing) * growing;
+        break;
+      }
+      growBy += step;
+      spaceLeft -= step * growing;
+    }
+
+    // The pixels left over go to the first children that can still grow
+    for (size_t i = 0; i < numChildren; ++i) {
+      int grow = std::min<long long>(_childRoom[i], growBy);
+      if (spaceLeft > 0 && _childRoom[i] > growBy) {
+        grow++;
+        spaceLeft--;
+      }
+      if (horizontal) {
+        _childRects[i].w += grow;
+      } else {
+        _childRects[i].h += grow;
+      }
+    }
+
+    // Whatever the children could not take goes to the spacing
+    if (spaceLeft > 0 && spaceCount > 0 && _spacing < _spaceingConstraint.maxValue) {
+      long long spacing = std::min<long long>(_spacing + spaceLeft / spaceCount, _spaceingConstraint.maxValue);
+      spaceLeft -= (spacing - _spacing) * spaceCount;
+      _spacing = spacing;
+    }
+
+    return spaceLeft;
+  }
+
   void Container::_findRecursive(const std::string& name, std::vector<std::shared_ptr<Widget>>& result) const
   {
     for (const auto& child : _children) {
@@ -575,17 +498,121 @@ namespace SGI {
     }
   }
 
+  void Container::_draw(double deltaTime)
+  {
+    if (!_cached || !_root || _bounds.w <= 0 || _bounds.h <= 0) {
+      _render(deltaTime);
+      return;
+    }
+
+    SDL_Renderer* renderer = _renderer.get();
+
+    if (!_cacheTexture || _cacheWidth != _bounds.w || _cacheHeight != _bounds.h) {
+      SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, _bounds.w, _bounds.h));
+      if (!texture) {
+        ERROR(CONTAINER, "Cache texture not created: %s", SDL_GetError());
+        _cached = false;
+        _render(deltaTime);
+        return;
+      }
+
+      // The cache holds premultiplied color, so it is composited with
+      // src + dst * (1 - srcAlpha) to avoid darkening soft edges.
+      SDL_SetTextureBlendMode(texture, SDL_ComposeCustomBlendMode(
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+      ));
+
+      _cacheTexture = std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
+        if (p) {
+          LOG(MEMORY, "SDL_Texture has been freed");
+          SDL_DestroyTexture(p);
+        }
+      });
+      _cacheWidth = _bounds.w;
+      _cacheHeight = _bounds.h;
+      _cacheValid = false;
+    }
+
+    if (!_cacheValid) {
+      // Batched draws have to land before the target changes
+      DrawList* drawList = DrawList::get(renderer);
+      if (drawList) {
+        drawList->flush();
+      }
+
+      SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+      SDL_SetRenderTarget(renderer, _cacheTexture.get());
+
+      // Offset the viewport so children keep drawing in window coordinates
+      SDL_Rect viewport = {-_bounds.x, -_bounds.y, _bounds.x + _bounds.w, _bounds.y + _bounds.h};
+      SDL_SetRenderViewport(renderer, &viewport);
+      SDL_SetRenderClipRect(renderer, nullptr);
+      SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+      SDL_RenderClear(renderer);
+
+      // The whole subtree is rendered, not just the damaged region
+      bool damageActive = _root->_damageActive;
+      _root->_damageActive = false;
+      _setClipRect(nullptr);
+      _render(deltaTime);
+      _root->_damageActive = damageActive;
+
+      if (drawList) {
+        drawList->flush();
+      }
+
+      SDL_SetRenderClipRect(renderer, nullptr);
+      SDL_SetRenderViewport(renderer, nullptr);
+      SDL_SetRenderTarget(renderer, previousTarget);
+      _cacheValid = true;
+      LOG(CONTAINER, "Cache of %s rendered", getName().c_str());
+    }
+
+    SDL_FRect dest = {(float)_bounds.x, (float)_bounds.y, (float)_bounds.w, (float)_bounds.h};
+    _setClipRect(nullptr);
+    _renderTexture(_cacheTexture.get(), nullptr, dest);
+  }
+
+  bool Container::_processPointerEvent(const SDL_Event *event)
+  {
+    // The Window has already routed the event to the children under
+    // the pointer, so their hover state is current
+    switch (event->type) {
+      case SDL_EVENT_MOUSE_BUTTON_DOWN: {
+        if (_mouseOver == true) {
+          bool overChild = false;
+          for (size_t i = 0; i < _children.size(); ++i) {
+            if (_children[i]->_mouseOver) {
+              overChild = true;
+              break;
+            }
+          }
+          if (!overChild) {
+            setFocused();
+          }
+        }
+        break;
+      }
+    }
+
+    return Widget::processEvent(event);
+  }
+
   void Container::_render(double deltaTime)
   {
     Widget::_render(deltaTime);
     bool dirty = false;
     for (size_t i = 0; i < _children.size(); ++i) {
-      _children[i]->_render(deltaTime);
+      if (_root && _root->_damageActive && !SDL_HasRectIntersection(&_children[i]->_bounds, &_root->_damageRect)) {
+        continue;
+      }
+      _children[i]->_drawProfiled(deltaTime);
       if (_children[i]->_dirty) {
         _children[i]->_dirty = false;
         dirty = true;
       }
-      SDL_SetRenderClipRect(_renderer.get(), NULL);
+      _setClipRect(nullptr);
     }
 
     if (dirty) {
@@ -598,7 +625,23 @@ namespace SGI {
     Widget::_renderOverlay(deltaTime);
     for (size_t i = 0; i < _children.size(); ++i) {
       _children[i]->_renderOverlay(deltaTime);
-      SDL_SetRenderClipRect(_renderer.get(), NULL);
+      _setClipRect(nullptr);
+    }
+  }
+
+  void Container::_updateLayout()
+  {
+    bool dirty = false;
+    for (size_t i = 0; i < _children.size(); ++i) {
+      _children[i]->_updateLayout();
+      if (_children[i]->_dirty) {
+        _children[i]->_dirty = false;
+        dirty = true;
+      }
+    }
+
+    if (dirty) {
+      _calculateChildrenBounds();
     }
   }
 
@@ -624,4 +667,16 @@ namespace SGI {
     }
   }
 
+  void Container::_setTheme(const Theme* theme)
+  {
+    if (_name == "WindowSidebarContainer") {
+      LOG(SIDEBAR, "%s", theme->name.c_str());
+    }
+    Widget::_setTheme(theme);
+    _cacheValid = false;
+    for (const auto& child : _children) {
+      child->_setTheme(theme);
+    }
+  }
+
 }
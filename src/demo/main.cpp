@@ -2,6 +2,7 @@
 #include <SDL3_image/SDL_image.h>
 
 #include "audioplayer.h"
+#include "bundle.h"
 #include "button.h"
 #include "debug.h"
 #include "flatbutton.h"
@@ -315,22 +316,15 @@ int main(int argc, char* args[]) {
     return 1;
   }
 
+  // Use the packed resources when they were built, loose files otherwise
+  SGI::Bundle::mount(std::string(SDL_GetBasePath()) + "resources.bundle");
+
   SGI::FontBook::addFont("future", "fonts/kenvector_future.ttf");
 
   SGI::WindowPtr win = SGI::Window::create("Test", 1024, 768);
   win->setName("window");
-  win->addTexture("menuIcon", "images/icons/menu.png");
-  win->addTexture("glassPanel", "images/ui/glassPanel.png", SGI::Window::TextureSlice{30, 30, 30, 30});
-  win->addTexture("glassPanelProjection", "images/ui/glassPanel_projection.png", SGI::Window::TextureSlice{30, 30, 30, 30});
-  win->addTexture("metalPanel", "images/ui/metalPanel.png", SGI::Window::TextureSlice{10, 10, 10, 10});
-  win->addTexture("metalPanelBlue", "images/ui/metalPanel_blue.png", SGI::Window::TextureSlice{10, 10, 30, 10});
-  win->addTexture("metalPanelBlueCorner", "images/ui/metalPanel_blueCorner.png", SGI::Window::TextureSlice{10, 50, 30, 10});
-  win->addTexture("metalPanelGreen", "images/ui/metalPanel_green.png", SGI::Window::TextureSlice{10, 10, 30, 10});
-  win->addTexture("metalPanelYellow", "images/ui/metalPanel_yellow.png", SGI::Window::TextureSlice{10, 10, 30, 10});
-  win->addTexture("button", "images/ui/button_1.png", SGI::Window::TextureSlice{22, 22, 22, 22});
-  win->addTexture("buttonHover", "images/ui/button_1_hover.png", SGI::Window::TextureSlice{22, 22, 22, 22});
-  win->addTexture("buttonPressed", "images/ui/button_1_pressed.png", SGI::Window::TextureSlice{22, 22, 22, 22});
-  win->addCursor(SGI::Window::CursorType::DEFAULT, "images/ui/cursor_pointerFlat.png");
+  win->addAtlas("uiatlas.json");
+  win->addCursorAsync(SGI::Window::CursorType::DEFAULT, "images/ui/cursor_pointerFlat.png");
 
   // win->setBackgroundTexture("metalPanel");
   win->setSpaceContent(SGI::Container::SpaceContent::Between);
@@ -538,9 +532,9 @@ int main(int argc, char* args[]) {
   // SGI::OptionGroupPtr og = SGI::OptionGroup::create();
   // og->setSpaceContent(SGI::Container::SpaceContent::Around);
   // og->setMultiselect(true);
-  // og->addChangeListener([](SGI::WindowPtr window, std::vector<SGI::FlatOptionPtr> widgets)->bool {
+  // og->addChangeListener([](SGI::WindowPtr window, const std::vector<SGI::FlatOptionPtr>& widgets)->bool {
   //   std::string selected = "";
-  //   for (auto w : widgets) {
+  //   for (const auto& w : widgets) {
   //     selected += w->getName() + " ";
   //   }
 
@@ -559,26 +553,14 @@ int main(int argc, char* args[]) {
   // o2->setConstraintFixed(SGI::Widget::ConstraintType::Width, 120);
   // og->addChild(o2);
 
-  SGI::AudioPlayer::load("test1", "audio/test.wav");
-  SGI::AudioPlayer::load("test2", "audio/test.ogg");
+  SGI::AudioPlayer::loadAsync("test1", "audio/test.wav");
+  SGI::AudioPlayer::loadStream("test2", "audio/test.ogg");
   // SGI::AudioPlayer::load("test3", "audio/test.m4a");
 
   // SGI::AudioPlayer::newBuffer("test1");
   // SGI::AudioPlayer::bufferAddMusic("test1", "O3T120L2CO4CO3L6BGABO4L2CO3L2CL2AL1GL2CFL4EL6CDEL4FL3DL6O2BO3CDL4EL2C");
 
-  bool quit = false;
-  SDL_Event e;
-  while (!quit) {
-    while (SDL_PollEvent(&e) != 0) {
-      win->processEvent(&e);
-
-      if (e.type == SDL_EVENT_QUIT) {
-        quit = true;
-      }
-    }
-  
-    win->render();
-  }
+  win->run();
 
   return 0;
 }
@@ -0,0 +1,249 @@
+#include <cmath>
+#include <SDL3/SDL.h>
+#include "debug.h"
+#include "drawlist.h"
+
+namespace SGI {
+  std::unordered_map<SDL_Renderer*, DrawList*> DrawList::_recording;
+
+  DrawList* DrawList::get(SDL_Renderer* renderer)
+  {
+    auto it = _recording.find(renderer);
+    if (it == _recording.end()) {
+      return nullptr;
+    }
+    return it->second;
+  }
+
+  void DrawList::begin(SDL_Renderer* renderer, const SDL_Rect* clip)
+  {
+    _renderer = renderer;
+    _vertices.clear();
+    _indices.clear();
+    _batches.clear();
+
+    _clips.clear();
+    _clips.push_back(clip ? Clip{true, *clip} : Clip{false, {0, 0, 0, 0}});
+    _clipStack.clear();
+    _clip = 0;
+    _clipApplied = false;
+
+    _stats = Stats();
+    _recording[renderer] = this;
+  }
+
+  void DrawList::end()
+  {
+    flush();
+    _lastStats = _stats;
+    _recording.erase(_renderer);
+  }
+
+  void DrawList::fillRect(const SDL_FRect& rect, SDL_Color color)
+  {
+    SDL_FColor fColor = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    SDL_Vertex vertices[4] = {
+      {{rect.x, rect.y}, fColor, {0, 0}},
+      {{rect.x + rect.w, rect.y}, fColor, {0, 0}},
+      {{rect.x + rect.w, rect.y + rect.h}, fColor, {0, 0}},
+      {{rect.x, rect.y + rect.h}, fColor, {0, 0}},
+    };
+    int indices[6] = {0, 1, 2, 2, 3, 0};
+
+    _stats.commands++;
+    _append(nullptr, vertices, 4, indices, 6);
+  }
+
+  void DrawList::flush()
+  {
+    if (_renderer == nullptr) {
+      return;
+    }
+
+    SDL_BlendMode drawBlendMode;
+    SDL_GetRenderDrawBlendMode(_renderer, &drawBlendMode);
+    SDL_BlendMode currentBlendMode = drawBlendMode;
+
+    for (const Batch& batch : _batches) {
+      if (!_clipApplied || !_sameClip(_clips[batch.clip], _clips[_appliedClip])) {
+        _useClip(_clips[batch.clip]);
+        _appliedClip = batch.clip;
+        _clipApplied = true;
+      }
+
+      // Untextured geometry uses the renderer's blend mode
+      if (batch.texture == nullptr && batch.blendMode != currentBlendMode) {
+        SDL_SetRenderDrawBlendMode(_renderer, batch.blendMode);
+        currentBlendMode = batch.blendMode;
+        _stats.calls++;
+      }
+
+      SDL_RenderGeometry(_renderer, batch.texture, &_vertices[batch.firstVertex], batch.vertexCount, &_indices[batch.firstIndex], batch.indexCount);
+      _stats.calls++;
+    }
+
+    if (currentBlendMode != drawBlendMode) {
+      SDL_SetRenderDrawBlendMode(_renderer, drawBlendMode);
+      _stats.calls++;
+    }
+
+    _stats.batches += _batches.size();
+    _vertices.clear();
+    _indices.clear();
+    _batches.clear();
+
+    // Anything drawn directly after a flush gets the current clip, and
+    // as it may also change the clip, it is set again on the next flush
+    _useClip(_clips[_clip]);
+    _clipApplied = false;
+  }
+
+  void DrawList::geometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
+  {
+    _stats.commands++;
+    _append(texture, vertices, numVertices, indices, numIndices);
+  }
+
+  DrawList::Stats DrawList::getStats()
+  {
+    return _lastStats;
+  }
+
+  void DrawList::popClip()
+  {
+    _stats.commands++;
+    if (_clipStack.empty()) {
+      return;
+    }
+    _clip = _clipStack.back();
+    _clipStack.pop_back();
+  }
+
+  void DrawList::pushClip(const SDL_Rect& rect)
+  {
+    _stats.commands++;
+    _clipStack.push_back(_clip);
+
+    Clip clip = {true, rect};
+    const Clip& current = _clips[_clip];
+    if (current.enabled && !SDL_GetRectIntersection(&current.rect, &rect, &clip.rect)) {
+      clip.rect = {0, 0, 0, 0};
+    }
+    _clips.push_back(clip);
+    _clip = _clips.size() - 1;
+  }
+
+  void DrawList::setClip(const SDL_Rect* rect)
+  {
+    _stats.commands++;
+
+    Clip clip = rect ? Clip{true, *rect} : Clip{false, {0, 0, 0, 0}};
+    if (_sameClip(clip, _clips[_clip])) {
+      return;
+    }
+    _clips.push_back(clip);
+    _clip = _clips.size() - 1;
+  }
+
+  void DrawList::texture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination, double angle)
+  {
+    _stats.commands++;
+    if (texture == nullptr) {
+      return;
+    }
+
+    float width, height;
+    if (!SDL_GetTextureSize(texture, &width, &height) || width <= 0 || height <= 0) {
+      return;
+    }
+
+    SDL_FRect src = source ? *source : SDL_FRect{0, 0, width, height};
+    float u1 = src.x / width;
+    float v1 = src.y / height;
+    float u2 = (src.x + src.w) / width;
+    float v2 = (src.y + src.h) / height;
+
+    // SDL_RenderGeometry ignores the texture's color mod, so it is baked in
+    Uint8 r = 255, g = 255, b = 255, a = 255;
+    SDL_GetTextureColorMod(texture, &r, &g, &b);
+    SDL_GetTextureAlphaMod(texture, &a);
+    SDL_FColor color = {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+
+    SDL_FPoint corners[4] = {
+      {destination.x, destination.y},
+      {destination.x + destination.w, destination.y},
+      {destination.x + destination.w, destination.y + destination.h},
+      {destination.x, destination.y + destination.h},
+    };
+
+    if (angle != 0.0) {
+      double radians = angle * M_PI / 180.0;
+      double s = sin(radians);
+      double c = cos(radians);
+      float centerX = destination.x + destination.w / 2;
+      float centerY = destination.y + destination.h / 2;
+      for (SDL_FPoint& corner : corners) {
+        float x = corner.x - centerX;
+        float y = corner.y - centerY;
+        corner.x = static_cast<float>(c * x - s * y + centerX);
+        corner.y = static_cast<float>(s * x + c * y + centerY);
+      }
+    }
+
+    SDL_Vertex vertices[4] = {
+      {corners[0], color, {u1, v1}},
+      {corners[1], color, {u2, v1}},
+      {corners[2], color, {u2, v2}},
+      {corners[3], color, {u1, v2}},
+    };
+    int indices[6] = {0, 1, 2, 2, 3, 0};
+
+    _append(texture, vertices, 4, indices, 6);
+  }
+
+  void DrawList::_append(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
+  {
+    if (numVertices <= 0) {
+      return;
+    }
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    if (texture) {
+      SDL_GetTextureBlendMode(texture, &blendMode);
+    } else {
+      SDL_GetRenderDrawBlendMode(_renderer, &blendMode);
+    }
+
+    if (_batches.empty() || _batches.back().texture != texture || _batches.back().blendMode != blendMode || !_sameClip(_clips[_batches.back().clip], _clips[_clip])) {
+      _batches.push_back({texture, blendMode, _clip, _vertices.size(), 0, _indices.size(), 0});
+    }
+
+    Batch& batch = _batches.back();
+    int base = batch.vertexCount;
+    _vertices.insert(_vertices.end(), vertices, vertices + numVertices);
+    batch.vertexCount += numVertices;
+
+    if (indices) {
+      for (int i = 0; i < numIndices; ++i) {
+        _indices.push_back(base + indices[i]);
+      }
+      batch.indexCount += numIndices;
+    } else {
+      for (int i = 0; i < numVertices; ++i) {
+        _indices.push_back(base + i);
+      }
+      batch.indexCount += numVertices;
+    }
+  }
+
+  bool DrawList::_sameClip(const Clip& a, const Clip& b)
+  {
+    return a.enabled == b.enabled && (!a.enabled || SDL_RectsEqual(&a.rect, &b.rect));
+  }
+
+  void DrawList::_useClip(const Clip& clip)
+  {
+    SDL_SetRenderClipRect(_renderer, clip.enabled ? &clip.rect : nullptr);
+    _stats.calls++;
+  }
+}
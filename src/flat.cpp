@@ -1,225 +1,24 @@
+#include <algorithm>
 #include <cmath>
 #include <SDL3/SDL.h>
 #include "debug.h"
+#include "drawlist.h"
 #include "flat.h"
+#include "theme.h"
 
 namespace SGI {
+  std::unordered_map<Flat::ShapeKey, Flat::ShapeMesh, Flat::ShapeKeyHash> Flat::_shapes;
+  std::vector<SDL_Vertex> Flat::_shapeVertices;
+
   Flat::Flat()
   {
-    // _themes["Light"] = Theme{
-    //   "Light",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#0055FF"), _hexToSDLColor("#0044CC"), _hexToSDLColor("#003399"), _hexToSDLColor("#0044CC") }, // Primary
-    //     { _hexToSDLColor("#CCCCCC"), _hexToSDLColor("#BBBBBB"), _hexToSDLColor("#AAAAAA"), _hexToSDLColor("#BBBBBB") }, // Secondary
-    //     { _hexToSDLColor("#FFCC00"), _hexToSDLColor("#D4A100"), _hexToSDLColor("#B88600"), _hexToSDLColor("#D4A100") }, // Tertiary
-    //     { _hexToSDLColor("#00CC99"), _hexToSDLColor("#009966"), _hexToSDLColor("#007744"), _hexToSDLColor("#009966") }, // Success
-    //     { _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#990000"), _hexToSDLColor("#CC0000") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#3399FF"), _hexToSDLColor("#2E89E6"), _hexToSDLColor("#FFFFFF"), _hexToSDLColor("#D1D1D1"),
-    //     _hexToSDLColor("#E0E0E0"), _hexToSDLColor("#0044CC"), _hexToSDLColor("#000000"), _hexToSDLColor("#004EAA") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#CCCCCC"), _hexToSDLColor("#B8B8B8"), _hexToSDLColor("#F0F0F0"), _hexToSDLColor("#D4D4D4"),
-    //     _hexToSDLColor("#F0F0F0"), _hexToSDLColor("#BBBBBB"), _hexToSDLColor("#666666"), _hexToSDLColor("#CCCCCC")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#F0F0F0"), _hexToSDLColor("#D1D1D1"), _hexToSDLColor("#FFFFFF"), _hexToSDLColor("#D1D1D1"),
-    //     _hexToSDLColor("#F0F0F0"), _hexToSDLColor("#0044CC"), _hexToSDLColor("#000000"), _hexToSDLColor("#004EAA")
-    //   }
-    // };
-
-
-    // _themes["Dark"] = Theme{
-    //   "Dark",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#007ACC"), _hexToSDLColor("#006BB3"), _hexToSDLColor("#005A99"), _hexToSDLColor("#006BB3") }, // Primary
-    //     { _hexToSDLColor("#3C3C3C"), _hexToSDLColor("#4A4A4A"), _hexToSDLColor("#5A5A5A"), _hexToSDLColor("#4A4A4A") }, // Secondary
-    //     { _hexToSDLColor("#FFCC00"), _hexToSDLColor("#D4A100"), _hexToSDLColor("#B88600"), _hexToSDLColor("#D4A100") }, // Tertiary
-    //     { _hexToSDLColor("#00CC99"), _hexToSDLColor("#009966"), _hexToSDLColor("#007744"), _hexToSDLColor("#009966") }, // Success
-    //     { _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#990000"), _hexToSDLColor("#CC0000") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#E6E6E6"), _hexToSDLColor("#CCCCCC"), _hexToSDLColor("#1E1E1E"), _hexToSDLColor("#2D2D2D"),
-    //     _hexToSDLColor("#252526"), _hexToSDLColor("#006BB3"), _hexToSDLColor("#D4D4D4"), _hexToSDLColor("#6D7991") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#3C3C3C"), _hexToSDLColor("#363636"), _hexToSDLColor("#2D2D2D"), _hexToSDLColor("#4A4A4A"),
-    //     _hexToSDLColor("#2D2D2D"), _hexToSDLColor("#4A4A4A"), _hexToSDLColor("#A6A6A6"), _hexToSDLColor("#6D7991")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#2D2D2D"), _hexToSDLColor("#2A2A2A"), _hexToSDLColor("#1E1E1E"), _hexToSDLColor("#2D2D2D"),
-    //     _hexToSDLColor("#252526"), _hexToSDLColor("#006BB3"), _hexToSDLColor("#D4D4D4"), _hexToSDLColor("#6D7991")
-    //   }
-    // };
-
-
-    // _themes["Alien Green"] = Theme{
-    //   "Alien Green",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#00FF00"), _hexToSDLColor("#00CC00"), _hexToSDLColor("#009900"), _hexToSDLColor("#00CC00") }, // Primary
-    //     { _hexToSDLColor("#006600"), _hexToSDLColor("#004C00"), _hexToSDLColor("#003300"), _hexToSDLColor("#004C00") }, // Secondary
-    //     { _hexToSDLColor("#FFCC00"), _hexToSDLColor("#D4A100"), _hexToSDLColor("#B88600"), _hexToSDLColor("#D4A100") }, // Tertiary
-    //     { _hexToSDLColor("#66FF66"), _hexToSDLColor("#4DB84D"), _hexToSDLColor("#33CC33"), _hexToSDLColor("#4DB84D") }, // Success
-    //     { _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#990000"), _hexToSDLColor("#CC0000") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00FF00"), _hexToSDLColor("#00E600"), _hexToSDLColor("#001A00"), _hexToSDLColor("#002200"),
-    //     _hexToSDLColor("#003300"), _hexToSDLColor("#00CC00"), _hexToSDLColor("#A6FFA6"), _hexToSDLColor("#00734E") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00FF00"), _hexToSDLColor("#00E600"), _hexToSDLColor("#002200"), _hexToSDLColor("#004400"),
-    //     _hexToSDLColor("#004400"), _hexToSDLColor("#4DB84D"), _hexToSDLColor("#66CC66"), _hexToSDLColor("#00734E")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00FF00"), _hexToSDLColor("#00E600"), _hexToSDLColor("#001A00"), _hexToSDLColor("#002200"),
-    //     _hexToSDLColor("#003300"), _hexToSDLColor("#00CC00"), _hexToSDLColor("#A6FFA6"), _hexToSDLColor("#00734E")
-    //   }
-    // };
-
-
-    // _themes["Techie Blue"] = Theme{
-    //   "Techie Blue",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#00BFFF"), _hexToSDLColor("#0099CC"), _hexToSDLColor("#006699"), _hexToSDLColor("#0099CC") }, // Primary
-    //     { _hexToSDLColor("#004080"), _hexToSDLColor("#003366"), _hexToSDLColor("#00264D"), _hexToSDLColor("#003366") }, // Secondary
-    //     { _hexToSDLColor("#FFA500"), _hexToSDLColor("#D48800"), _hexToSDLColor("#CC7000"), _hexToSDLColor("#D48800") }, // Tertiary
-    //     { _hexToSDLColor("#66CFFF"), _hexToSDLColor("#4DB8E6"), _hexToSDLColor("#3399CC"), _hexToSDLColor("#4DB8E6") }, // Success
-    //     { _hexToSDLColor("#FF4D4D"), _hexToSDLColor("#FF1A1A"), _hexToSDLColor("#B30000"), _hexToSDLColor("#FF1A1A") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00BFFF"), _hexToSDLColor("#00ACED"), _hexToSDLColor("#001F33"), _hexToSDLColor("#00264D"),
-    //     _hexToSDLColor("#003366"), _hexToSDLColor("#0099CC"), _hexToSDLColor("#80D4FF"), _hexToSDLColor("#005480") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00BFFF"), _hexToSDLColor("#00ACED"), _hexToSDLColor("#00264D"), _hexToSDLColor("#004080"),
-    //     _hexToSDLColor("#004080"), _hexToSDLColor("#4DB8E6"), _hexToSDLColor("#80CFFF"), _hexToSDLColor("#005480")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#00BFFF"), _hexToSDLColor("#00ACED"), _hexToSDLColor("#001F33"), _hexToSDLColor("#00264D"),
-    //     _hexToSDLColor("#003366"), _hexToSDLColor("#0099CC"), _hexToSDLColor("#80D4FF"), _hexToSDLColor("#005480")
-    //   }
-    // };
-
-
-    // _themes["Devil Red"] = Theme{
-    //   "Devilish Red",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#990000"), _hexToSDLColor("#CC0000") }, // Primary
-    //     { _hexToSDLColor("#660000"), _hexToSDLColor("#4D0000"), _hexToSDLColor("#330000"), _hexToSDLColor("#4D0000") }, // Secondary
-    //     { _hexToSDLColor("#FFA500"), _hexToSDLColor("#CC8400"), _hexToSDLColor("#996300"), _hexToSDLColor("#CC8400") }, // Tertiary
-    //     { _hexToSDLColor("#FF6666"), _hexToSDLColor("#E64D4D"), _hexToSDLColor("#CC3333"), _hexToSDLColor("#E64D4D") }, // Success
-    //     { _hexToSDLColor("#000000"), _hexToSDLColor("#262626"), _hexToSDLColor("#333333"), _hexToSDLColor("#262626") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC2900"), _hexToSDLColor("#330000"), _hexToSDLColor("#590000"),
-    //     _hexToSDLColor("#4D0000"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#FF9999"), _hexToSDLColor("#800000") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC2900"), _hexToSDLColor("#590000"), _hexToSDLColor("#800000"),
-    //     _hexToSDLColor("#660000"), _hexToSDLColor("#E64D4D"), _hexToSDLColor("#FF6666"), _hexToSDLColor("#800000")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC2900"), _hexToSDLColor("#330000"), _hexToSDLColor("#590000"),
-    //     _hexToSDLColor("#4D0000"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#FF9999"), _hexToSDLColor("#800000")
-    //   }
-    // };
-
-    // _themes["Pastel"] = Theme{
-    //   "Pastel",
-    //   ButtonStyles{
-    //     { _hexToSDLColor("#FFB3B3"), _hexToSDLColor("#FF9999"), _hexToSDLColor("#FF6666"), _hexToSDLColor("#FF9999") }, // Primary
-    //     { _hexToSDLColor("#FFFF99"), _hexToSDLColor("#FFFF66"), _hexToSDLColor("#FFFF33"), _hexToSDLColor("#FFFF66") }, // Secondary
-    //     { _hexToSDLColor("#FFCCFF"), _hexToSDLColor("#FF99FF"), _hexToSDLColor("#FF66FF"), _hexToSDLColor("#FF99FF") }, // Tertiary
-    //     { _hexToSDLColor("#99FF99"), _hexToSDLColor("#66FF66"), _hexToSDLColor("#33FF33"), _hexToSDLColor("#66FF66") }, // Success
-    //     { _hexToSDLColor("#FF3333"), _hexToSDLColor("#CC0000"), _hexToSDLColor("#990000"), _hexToSDLColor("#CC0000") }  // Danger
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FFB3B3"), _hexToSDLColor("#E680B2"), _hexToSDLColor("#FFFFFF"), _hexToSDLColor("#FFD9D9"),
-    //     _hexToSDLColor("#FFE6E6"), _hexToSDLColor("#FF9999"), _hexToSDLColor("#FF3333"), _hexToSDLColor("#FF9999") // Text Select Color adjusted
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FFB3B3"), _hexToSDLColor("#80E6B2"), _hexToSDLColor("#FFFFE6"), _hexToSDLColor("#FFFF99"),
-    //     _hexToSDLColor("#FFFFE6"), _hexToSDLColor("#FFFF66"), _hexToSDLColor("#FF6666"), _hexToSDLColor("#FFFF99")
-    //   },
-    //   Colors{
-    //     _hexToSDLColor("#FFE6E6"), _hexToSDLColor("#B2E680"), _hexToSDLColor("#FFFFFF"), _hexToSDLColor("#FFE6FF"),
-    //     _hexToSDLColor("#FFFFFF"), _hexToSDLColor("#FFB3FF"), _hexToSDLColor("#FF3333"), _hexToSDLColor("#FF9999")
-    //   }
-    // };
-
-    SDL_Color darkText = {255, 255, 255, 255};          // White text
-    SDL_Color darkFill = {50, 50, 50, 255};             // Dark gray fill
-    SDL_Color darkBorder = {70, 70, 70, 255};           // Dark gray border
-    SDL_Color darkBackground = {30, 30, 30, 255};       // Darkest color for background
-    SDL_Color darkAccentFill = {100, 100, 100, 255};    // Accent fill
-    SDL_Color darkAccentBorder = {150, 150, 150, 255};  // Accent border
-    SDL_Color darkFocusedBorder = {120, 120, 120, 255}; // Slightly lighter focused border
-    SDL_Color disabledText = {180, 180, 180, 255};      // Light gray text for disabled state
-    SDL_Color disabledFill = {60, 60, 60, 255};         // Lighter gray for disabled fill
-    SDL_Color disabledBorder = {90, 90, 90, 255};       // Lighter gray for disabled border
-
-    Theme darkTheme = {
-      "Dark",
-      {
-        {
-          {darkText, darkFill, darkBorder},
-          {darkText, {70, 70, 70, 255}, darkBorder},
-          {darkText, {100, 100, 100, 255}, darkBorder},
-          {disabledText, disabledFill, disabledBorder}
-        },
-        {
-          {darkText, darkFill, darkBorder},
-          {darkText, {70, 70, 70, 255}, darkBorder},
-          {darkText, {100, 100, 100, 255}, darkBorder},
-          {disabledText, disabledFill, disabledBorder}
-        },
-        {
-          {darkText, {255, 140, 0, 255}, darkBorder},
-          {darkText, {255, 165, 0, 255}, darkBorder},
-          {darkText, {255, 180, 0, 255}, darkBorder},
-          {disabledText, disabledFill, disabledBorder}
-        },
-        {
-          {darkText, {0, 120, 200, 255}, darkBorder},
-          {darkText, {0, 140, 230, 255}, darkBorder},
-          {darkText, {0, 160, 250, 255}, darkBorder},
-          {disabledText, disabledFill, disabledBorder}
-        },
-        {
-          {darkText, {200, 0, 0, 255}, darkBorder},
-          {darkText, {220, 0, 0, 255}, darkBorder},
-          {darkText, {240, 0, 0, 255}, darkBorder},
-          {disabledText, disabledFill, disabledBorder}
-        }
-      },
-      {
-        // Colors
-        darkAccentBorder,
-        darkAccentFill,
-        darkBackground,
-        darkBorder,
-        darkFill,
-        darkFocusedBorder,
-        darkText,
-        {255, 255, 255, 255} // Text select color (white highlight)
-      }
-    };
-
-    // Add to themes
-    _themes["Dark"] = darkTheme;
   }
 
-  const Flat::Theme& Flat::_getTheme(const std::string& themeName) const
+  void Flat::setTheme(const std::string& name)
   {
-    auto it = _themes.find(themeName);
-    if (it != _themes.end()) {
-      return it ->second;
-    }
-    LOG(FLAT, "Theme \"%s\" not found, using Dark", themeName.c_str());
-    return _themes.at("Dark");
+    _setTheme(Themes::resolve(name));
   }
-  
+
   void Flat::_drawArc(SDL_Renderer* renderer, int centerX, int centerY, int radius, int startAngle, int endAngle, int lineWidth, SDL_Color lineColor, SDL_Color fillColor, bool filled)
   {
     startAngle = startAngle % 360;
@@ -229,100 +28,290 @@ namespace SGI {
       endAngle += 360;
     }
 
-    // Draw filled arc if needed
-    if (filled) {
-      SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-      for (int angle = startAngle; angle <= endAngle; ++angle) {
-        for (int r = 0; r <= radius; ++r) {
-          int x = static_cast<int>(centerX + r * cos(_degreesToRadians(angle)));
-          int y = static_cast<int>(centerY + r * sin(_degreesToRadians(angle)));
-          SDL_RenderPoint(renderer, x, y);
-        }
+    ShapeKey key = {ShapeType::Arc, 0, 0, radius, lineWidth, filled, startAngle * 10, endAngle * 10};
+    _renderShape(renderer, _getShape(key), centerX, centerY, lineColor, fillColor);
+  }
+
+  void Flat::_drawChevron(SDL_Renderer* renderer, SDL_Point center, int size, double angle, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth)
+  {
+    ShapeKey key = {ShapeType::Chevron, size, size, 0, lineWidth, filled, static_cast<int>(std::lround(angle * 10)), 0};
+    _renderShape(renderer, _getShape(key), center.x, center.y, lineColor, fillColor);
+  }
+
+  void Flat::_drawRoundedRect(SDL_Renderer* renderer, SDL_Rect bounds, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth, int cornerRadius)
+  {
+    ShapeKey key = {ShapeType::RoundedRect, bounds.w, bounds.h, cornerRadius, lineWidth, filled, 0, 0};
+    _renderShape(renderer, _getShape(key), bounds.x, bounds.y, lineColor, fillColor);
+  }
+
+  void Flat::_addFan(ShapeMesh& mesh, SDL_FPoint center, const std::vector<SDL_FPoint>& contour, bool closed)
+  {
+    if (contour.size() < 2) {
+      return;
+    }
+
+    int base = mesh.vertices.size();
+    mesh.vertices.push_back({center, false, 1.0f});
+    for (const SDL_FPoint& point : contour) {
+      mesh.vertices.push_back({point, false, 1.0f});
+    }
+
+    int count = contour.size();
+    int edges = closed ? count : count - 1;
+    for (int i = 0; i < edges; ++i) {
+      mesh.indices.insert(mesh.indices.end(), {base, base + 1 + i, base + 1 + (i + 1) % count});
+    }
+  }
+
+  void Flat::_addRing(ShapeMesh& mesh, const std::vector<SDL_FPoint>& outer, float outerCoverage, const std::vector<SDL_FPoint>& inner, float innerCoverage, bool closed)
+  {
+    if (outer.size() < 2 || outer.size() != inner.size()) {
+      return;
+    }
+
+    int base = mesh.vertices.size();
+    int count = outer.size();
+    for (int i = 0; i < count; ++i) {
+      mesh.vertices.push_back({outer[i], true, outerCoverage});
+      mesh.vertices.push_back({inner[i], true, innerCoverage});
+    }
+
+    int edges = closed ? count : count - 1;
+    for (int i = 0; i < edges; ++i) {
+      int a = base + i * 2;
+      int b = base + ((i + 1) % count) * 2;
+      mesh.indices.insert(mesh.indices.end(), {a, b, a + 1, a + 1, b, b + 1});
+    }
+  }
+
+  std::vector<SDL_FPoint> Flat::_arcContour(float radius, float startAngle, float endAngle, int segments)
+  {
+    std::vector<SDL_FPoint> contour;
+    contour.reserve(segments + 1);
+    radius = std::max(radius, 0.0f);
+    for (int i = 0; i <= segments; ++i) {
+      double angle = _degreesToRadians(startAngle + (endAngle - startAngle) * i / segments);
+      contour.push_back({static_cast<float>(radius * cos(angle)), static_cast<float>(radius * sin(angle))});
+    }
+    return contour;
+  }
+
+  const Flat::ShapeMesh& Flat::_getShape(const ShapeKey& key)
+  {
+    auto it = _shapes.find(key);
+    if (it != _shapes.end()) {
+      return it->second;
+    }
+
+    // Shapes are keyed by size, so resizing can create a lot of them
+    if (_shapes.size() >= MAX_SHAPES) {
+      _shapes.clear();
+    }
+
+    switch (key.type) {
+      case ShapeType::Arc:
+        return _shapes.emplace(key, _tessellateArc(key)).first->second;
+      case ShapeType::Chevron:
+        return _shapes.emplace(key, _tessellateChevron(key)).first->second;
+      case ShapeType::RoundedRect:
+      default:
+        return _shapes.emplace(key, _tessellateRoundedRect(key)).first->second;
+    }
+  }
+
+  std::vector<SDL_FPoint> Flat::_offsetContour(const std::vector<SDL_FPoint>& contour, float inset)
+  {
+    // Moves each point of a convex contour along its miter towards the centroid
+    SDL_FPoint centroid = {0, 0};
+    for (const SDL_FPoint& point : contour) {
+      centroid.x += point.x / contour.size();
+      centroid.y += point.y / contour.size();
+    }
+
+    auto inwardNormal = [&](SDL_FPoint a, SDL_FPoint b) {
+      SDL_FPoint normal = {-(b.y - a.y), b.x - a.x};
+      float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+      if (length > 0) {
+        normal.x /= length;
+        normal.y /= length;
+      }
+      SDL_FPoint middle = {(a.x + b.x) / 2 - centroid.x, (a.y + b.y) / 2 - centroid.y};
+      if (normal.x * middle.x + normal.y * middle.y > 0) {
+        normal.x = -normal.x;
+        normal.y = -normal.y;
       }
+      return normal;
+    };
+
+    std::vector<SDL_FPoint> offset;
+    size_t count = contour.size();
+    for (size_t i = 0; i < count; ++i) {
+      SDL_FPoint previous = contour[(i + count - 1) % count];
+      SDL_FPoint next = contour[(i + 1) % count];
+      SDL_FPoint n1 = inwardNormal(previous, contour[i]);
+      SDL_FPoint n2 = inwardNormal(contour[i], next);
+      SDL_FPoint miter = {n1.x + n2.x, n1.y + n2.y};
+      float length = std::sqrt(miter.x * miter.x + miter.y * miter.y);
+      if (length > 0) {
+        miter.x /= length;
+        miter.y /= length;
+      }
+      float scale = miter.x * n1.x + miter.y * n1.y;
+      scale = scale > 0.1f ? inset / scale : inset;
+      offset.push_back({contour[i].x + miter.x * scale, contour[i].y + miter.y * scale});
     }
+    return offset;
+  }
 
-    // Draw border arc
-    SDL_SetRenderDrawColor(renderer, lineColor.r, lineColor.g, lineColor.b, lineColor.a);
-    for (int angle = startAngle; angle <= endAngle; ++angle) {
-      int x = static_cast<int>(centerX + radius * cos(_degreesToRadians(angle)));
-      int y = static_cast<int>(centerY + radius * sin(_degreesToRadians(angle)));
-      SDL_RenderPoint(renderer, x, y);
+  void Flat::_renderShape(SDL_Renderer* renderer, const ShapeMesh& mesh, float x, float y, SDL_Color lineColor, SDL_Color fillColor)
+  {
+    if (mesh.indices.empty()) {
+      return;
     }
+
+    SDL_FColor line = {lineColor.r / 255.0f, lineColor.g / 255.0f, lineColor.b / 255.0f, lineColor.a / 255.0f};
+    SDL_FColor fill = {fillColor.r / 255.0f, fillColor.g / 255.0f, fillColor.b / 255.0f, fillColor.a / 255.0f};
+
+    _shapeVertices.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+      const ShapeVertex& vertex = mesh.vertices[i];
+      SDL_Vertex& output = _shapeVertices[i];
+      output.position.x = x + vertex.position.x;
+      output.position.y = y + vertex.position.y;
+      output.color = vertex.line ? line : fill;
+      output.color.a *= vertex.coverage;
+      output.tex_coord = {0, 0};
+    }
+
+    DrawList* drawList = DrawList::get(renderer);
+    if (drawList) {
+      drawList->geometry(nullptr, _shapeVertices.data(), _shapeVertices.size(), mesh.indices.data(), mesh.indices.size());
+      return;
+    }
+
+    SDL_RenderGeometry(renderer, nullptr, _shapeVertices.data(), _shapeVertices.size(), mesh.indices.data(), mesh.indices.size());
   }
 
-  void Flat::_drawChevron(SDL_Renderer* renderer, SDL_Point center, int size, double angle, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth)
+  std::vector<SDL_FPoint> Flat::_roundedRectContour(float w, float h, float radius, float inset, int segments)
+  {
+    // The corners share their centers with the outer edge until the
+    // inset is larger than the radius, then the corners are square
+    float center = std::max(radius, inset);
+    float cornerRadius = std::max(radius - inset, 0.0f);
+
+    SDL_FPoint centers[4] = {
+      {center, center},
+      {w - center, center},
+      {w - center, h - center},
+      {center, h - center},
+    };
+
+    std::vector<SDL_FPoint> contour;
+    contour.reserve((segments + 1) * 4);
+    for (int corner = 0; corner < 4; ++corner) {
+      std::vector<SDL_FPoint> arc = _arcContour(cornerRadius, 180 + corner * 90, 270 + corner * 90, segments);
+      for (const SDL_FPoint& point : arc) {
+        contour.push_back({centers[corner].x + point.x, centers[corner].y + point.y});
+      }
+    }
+    return contour;
+  }
+
+  Flat::ShapeMesh Flat::_tessellateArc(const ShapeKey& key)
   {
-    SDL_FPoint points[3];
+    ShapeMesh mesh;
+    float startAngle = key.startAngle / 10.0f;
+    float endAngle = key.endAngle / 10.0f;
+    float halfWidth = std::max(key.lineWidth, 1) / 2.0f;
+    int segments = std::clamp(static_cast<int>((endAngle - startAngle) / 90 * (key.radius / 2 + 2)), 2, 64);
+
+    // The line fades out over half a pixel on each side
+    float outerEdge = key.radius + halfWidth;
+    float innerEdge = key.radius - halfWidth;
+    std::vector<SDL_FPoint> outer = _arcContour(outerEdge + 0.5f, startAngle, endAngle, segments);
+    std::vector<SDL_FPoint> outerSolid = _arcContour(std::max(outerEdge - 0.5f, static_cast<float>(key.radius)), startAngle, endAngle, segments);
+    std::vector<SDL_FPoint> innerSolid = _arcContour(std::min(innerEdge + 0.5f, static_cast<float>(key.radius)), startAngle, endAngle, segments);
+
+    if (key.filled) {
+      _addFan(mesh, {0, 0}, innerSolid, false);
+    }
 
-    int halfSize = size / 2;
+    _addRing(mesh, outer, 0.0f, outerSolid, 1.0f, false);
+    _addRing(mesh, outerSolid, 1.0f, innerSolid, 1.0f, false);
+    if (!key.filled) {
+      std::vector<SDL_FPoint> inner = _arcContour(innerEdge - 0.5f, startAngle, endAngle, segments);
+      _addRing(mesh, innerSolid, 1.0f, inner, 0.0f, false);
+    }
+
+    return mesh;
+  }
+
+  Flat::ShapeMesh Flat::_tessellateChevron(const ShapeKey& key)
+  {
+    ShapeMesh mesh;
+
+    int halfSize = key.w / 2;
     int height = static_cast<int>(halfSize * std::sqrt(3));
+    if (halfSize <= 0 || height <= 0) {
+      return mesh;
+    }
 
     // Define the points of the chevron relative to the center
-    points[0] = { static_cast<float>(center.x), static_cast<float>(center.y - (2 * height / 3))};
-    points[1] = { static_cast<float>(center.x - halfSize), static_cast<float>(center.y + (height / 3))};
-    points[2] = { static_cast<float>(center.x + halfSize), static_cast<float>(center.y + (height / 3))};
+    std::vector<SDL_FPoint> points = {
+      {0, static_cast<float>(-(2 * height / 3))},
+      {static_cast<float>(-halfSize), static_cast<float>(height / 3)},
+      {static_cast<float>(halfSize), static_cast<float>(height / 3)},
+    };
 
-    for (int i = 0; i < 3; ++i) {
-      points[i] = _rotatePoint(points[i], center, angle);
-    }
-    
-    if (filled) {
-      // Use SDL_RenderGeometry for filled rendering
-      SDL_Vertex vertices[3];
-      for (int i = 0; i < 3; ++i) {
-        vertices[i].position.x = static_cast<float>(points[i].x);
-        vertices[i].position.y = static_cast<float>(points[i].y);
-        vertices[i].color.r = static_cast<float>(fillColor.r / 255.0);
-        vertices[i].color.g = static_cast<float>(fillColor.g / 255.0);
-        vertices[i].color.b = static_cast<float>(fillColor.b / 255.0);
-        vertices[i].color.a = static_cast<float>(fillColor.a / 255.0);
-      }
-      SDL_RenderGeometry(renderer, nullptr, vertices, 3, nullptr, 0);
+    for (SDL_FPoint& point : points) {
+      point = _rotatePoint(point, {0, 0}, key.startAngle / 10.0);
     }
 
-    // Set the line color
-    SDL_SetRenderDrawColor(renderer, lineColor.r, lineColor.g, lineColor.b, lineColor.a);
+    std::vector<SDL_FPoint> outer = _offsetContour(points, -0.5f);
+    std::vector<SDL_FPoint> edge = _offsetContour(points, 0.5f);
+    std::vector<SDL_FPoint> inner = _offsetContour(points, std::max(key.lineWidth, 1));
 
-    // Draw the outline of the chevron
-    for (int i = 0; i < 3; ++i) {
-        SDL_RenderLine(renderer, points[i].x, points[i].y, points[(i + 1) % 3].x, points[(i + 1) % 3].y);
+    _addRing(mesh, outer, 0.0f, edge, 1.0f, true);
+    _addRing(mesh, edge, 1.0f, inner, 1.0f, true);
+    if (key.filled) {
+      _addFan(mesh, {0, 0}, inner, true);
+    } else {
+      _addRing(mesh, inner, 1.0f, _offsetContour(points, std::max(key.lineWidth, 1) + 1), 0.0f, true);
     }
+
+    return mesh;
   }
 
-  void Flat::_drawRoundedRect(SDL_Renderer* renderer, SDL_Rect bounds, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth, int cornerRadius)
+  Flat::ShapeMesh Flat::_tessellateRoundedRect(const ShapeKey& key)
   {
-    // Draw filled rounded rectangle first if filled is true
-    if (filled) {
-      // Set fill color and draw the filled rectangle without the corners
-      SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-
-      // Draw the central rectangle
-      SDL_FRect innerRect = { static_cast<float>(bounds.x) + static_cast<float>(cornerRadius), static_cast<float>(bounds.y), static_cast<float>(bounds.w) - 2 * static_cast<float>(cornerRadius), static_cast<float>(bounds.h) };
-      SDL_RenderFillRect(renderer, &innerRect);
-
-      // Draw the vertical sides
-      SDL_FRect leftRect = { static_cast<float>(bounds.x), static_cast<float>(bounds.y) + static_cast<float>(cornerRadius), static_cast<float>(cornerRadius), static_cast<float>(bounds.h) - 2 * static_cast<float>(cornerRadius) };
-      SDL_FRect rightRect = { static_cast<float>(bounds.x) + static_cast<float>(bounds.w) - static_cast<float>(cornerRadius), static_cast<float>(bounds.y) + static_cast<float>(cornerRadius), static_cast<float>(cornerRadius), static_cast<float>(bounds.h) - 2 * static_cast<float>(cornerRadius) };
-      SDL_RenderFillRect(renderer, &leftRect);
-      SDL_RenderFillRect(renderer, &rightRect);
+    ShapeMesh mesh;
+    if (key.w <= 0 || key.h <= 0) {
+      return mesh;
+    }
+
+    float w = key.w;
+    float h = key.h;
+    float radius = std::clamp(static_cast<float>(key.radius), 0.0f, std::min(w, h) / 2);
+    float lineWidth = std::max(key.lineWidth, 0);
+    int segments = std::clamp(static_cast<int>(radius) / 2 + 2, 2, 16);
+
+    // The outside edge fades out over a pixel centered on the bounds
+    std::vector<SDL_FPoint> outer = _roundedRectContour(w, h, radius, -0.5f, segments);
+    std::vector<SDL_FPoint> edge = _roundedRectContour(w, h, radius, 0.5f, segments);
+    std::vector<SDL_FPoint> inner = _roundedRectContour(w, h, radius, lineWidth, segments);
+
+    _addRing(mesh, outer, 0.0f, edge, 1.0f, true);
+    if (lineWidth > 0.5f) {
+      _addRing(mesh, edge, 1.0f, inner, 1.0f, true);
+    }
+
+    if (key.filled) {
+      _addFan(mesh, {w / 2, h / 2}, inner, true);
+    } else {
+      _addRing(mesh, inner, 1.0f, _roundedRectContour(w, h, radius, lineWidth + 1, segments), 0.0f, true);
     }
 
-    SDL_SetRenderDrawColor(renderer, lineColor.r, lineColor.g, lineColor.b, lineColor.a);
-
-    SDL_FRect topRect = { static_cast<float>(bounds.x) + static_cast<float>(cornerRadius), static_cast<float>(bounds.y), static_cast<float>(bounds.w) - 2 * static_cast<float>(cornerRadius), static_cast<float>(lineWidth) };
-    SDL_FRect bottomRect = { static_cast<float>(bounds.x) + static_cast<float>(cornerRadius), static_cast<float>(bounds.y) + static_cast<float>(bounds.h) - static_cast<float>(lineWidth), static_cast<float>(bounds.w) - 2 * static_cast<float>(cornerRadius), static_cast<float>(lineWidth) };
-    SDL_FRect leftBorderRect = { static_cast<float>(bounds.x), static_cast<float>(bounds.y) + static_cast<float>(cornerRadius), static_cast<float>(lineWidth), static_cast<float>(bounds.h) - 2 * static_cast<float>(cornerRadius) };
-    SDL_FRect rightBorderRect = { static_cast<float>(bounds.x) + static_cast<float>(bounds.w) - static_cast<float>(lineWidth), static_cast<float>(bounds.y) + static_cast<float>(cornerRadius), static_cast<float>(lineWidth), static_cast<float>(bounds.h) - 2 * static_cast<float>(cornerRadius) };
-    SDL_RenderFillRect(renderer, &topRect);
-    SDL_RenderFillRect(renderer, &bottomRect);
-    SDL_RenderFillRect(renderer, &leftBorderRect);
-    SDL_RenderFillRect(renderer, &rightBorderRect);
-  
-    int arcRadius = cornerRadius - lineWidth / 2;
-    _drawArc(renderer, static_cast<float>(bounds.x + cornerRadius), static_cast<float>(bounds.y + cornerRadius), arcRadius, 180, 270, lineWidth, lineColor, fillColor, filled);
-    _drawArc(renderer, static_cast<float>(bounds.x + bounds.w - cornerRadius), static_cast<float>(bounds.y + cornerRadius), arcRadius, 270, 360, lineWidth, lineColor, fillColor, filled);
-    _drawArc(renderer, static_cast<float>(bounds.x + cornerRadius), static_cast<float>(bounds.y + bounds.h - cornerRadius), arcRadius, 90, 180, lineWidth, lineColor, fillColor, filled);
-    _drawArc(renderer, static_cast<float>(bounds.x + bounds.w - cornerRadius), static_cast<float>(bounds.y + bounds.h - cornerRadius), arcRadius, 0, 90, lineWidth, lineColor, fillColor, filled);
+    return mesh;
   }
 
   SDL_FPoint Flat::_rotatePoint(SDL_FPoint point, SDL_Point origin, double angle)
@@ -5,6 +5,7 @@
 #include "debug.h"
 #include "flatbutton.h"
 #include "fontbook.h"
+#include "profiler.h"
 #include "window.h"
 
 namespace SGI {
@@ -32,12 +33,6 @@ namespace SGI {
     if (_textTexture != nullptr) {
       SDL_DestroyTexture(_textTexture);
     }
-    if (_textTextureHover != nullptr) {
-      SDL_DestroyTexture(_textTexture);
-    }
-    if (_textTexturePressed != nullptr) {
-      SDL_DestroyTexture(_textTexture);
-    }
   }
 
   std::string FlatButton::getFontName()
@@ -74,6 +69,7 @@ namespace SGI {
     _borderColor = color;
     _borderColorHover = colorHover;
     _borderColorPressed = colorPressed;
+    _invalidate();
   }
 
   void FlatButton::setDisabled(bool value) 
@@ -127,6 +123,7 @@ namespace SGI {
     }
 
     _radius = value;
+    _invalidate();
   }
 
   void FlatButton::setStyle(const Style value)
@@ -136,183 +133,184 @@ namespace SGI {
     if (_disabled) {
       switch (_style) {
         case Style::Primary:
-            _textColor = _theme.buttons.primary.disabledColor.text;
-            _textColorHover = _theme.buttons.primary.disabledColor.text;
-            _textColorPressed = _theme.buttons.primary.disabledColor.text;
-            _borderColor = _theme.buttons.primary.disabledColor.border;
-            _borderColorHover = _theme.buttons.primary.disabledColor.border;
-            _borderColorPressed = _theme.buttons.primary.disabledColor.border;
-            _fillColor = _theme.buttons.primary.disabledColor.fill;
-            _fillColorHover = _theme.buttons.primary.disabledColor.fill;
-            _fillColorPressed = _theme.buttons.primary.disabledColor.fill;
+            _textColor = _theme->buttons.primary.disabledColor.text;
+            _textColorHover = _theme->buttons.primary.disabledColor.text;
+            _textColorPressed = _theme->buttons.primary.disabledColor.text;
+            _borderColor = _theme->buttons.primary.disabledColor.border;
+            _borderColorHover = _theme->buttons.primary.disabledColor.border;
+            _borderColorPressed = _theme->buttons.primary.disabledColor.border;
+            _fillColor = _theme->buttons.primary.disabledColor.fill;
+            _fillColorHover = _theme->buttons.primary.disabledColor.fill;
+            _fillColorPressed = _theme->buttons.primary.disabledColor.fill;
           break;
         case Style::Secondary:
-            _textColor = _theme.buttons.secondary.disabledColor.text;
-            _textColorHover = _theme.buttons.secondary.disabledColor.text;
-            _textColorPressed = _theme.buttons.secondary.disabledColor.text;
-            _borderColor = _theme.buttons.secondary.disabledColor.border;
-            _borderColorHover = _theme.buttons.secondary.disabledColor.border;
-            _borderColorPressed = _theme.buttons.secondary.disabledColor.border;
-            _fillColor = _theme.buttons.secondary.disabledColor.fill;
-            _fillColorHover = _theme.buttons.secondary.disabledColor.fill;
-            _fillColorPressed = _theme.buttons.secondary.disabledColor.fill;
+            _textColor = _theme->buttons.secondary.disabledColor.text;
+            _textColorHover = _theme->buttons.secondary.disabledColor.text;
+            _textColorPressed = _theme->buttons.secondary.disabledColor.text;
+            _borderColor = _theme->buttons.secondary.disabledColor.border;
+            _borderColorHover = _theme->buttons.secondary.disabledColor.border;
+            _borderColorPressed = _theme->buttons.secondary.disabledColor.border;
+            _fillColor = _theme->buttons.secondary.disabledColor.fill;
+            _fillColorHover = _theme->buttons.secondary.disabledColor.fill;
+            _fillColorPressed = _theme->buttons.secondary.disabledColor.fill;
           break;
         case Style::Info:
-            _textColor = _theme.buttons.info.disabledColor.text;
-            _textColorHover = _theme.buttons.info.disabledColor.text;
-            _textColorPressed = _theme.buttons.info.disabledColor.text;
-            _borderColor = _theme.buttons.info.disabledColor.border;
-            _borderColorHover = _theme.buttons.info.disabledColor.border;
-            _borderColorPressed = _theme.buttons.info.disabledColor.border;
-            _fillColor = _theme.buttons.info.disabledColor.fill;
-            _fillColorHover = _theme.buttons.info.disabledColor.fill;
-            _fillColorPressed = _theme.buttons.info.disabledColor.fill;
+            _textColor = _theme->buttons.info.disabledColor.text;
+            _textColorHover = _theme->buttons.info.disabledColor.text;
+            _textColorPressed = _theme->buttons.info.disabledColor.text;
+            _borderColor = _theme->buttons.info.disabledColor.border;
+            _borderColorHover = _theme->buttons.info.disabledColor.border;
+            _borderColorPressed = _theme->buttons.info.disabledColor.border;
+            _fillColor = _theme->buttons.info.disabledColor.fill;
+            _fillColorHover = _theme->buttons.info.disabledColor.fill;
+            _fillColorPressed = _theme->buttons.info.disabledColor.fill;
           break;
         case Style::Warning:
-            _textColor = _theme.buttons.warning.disabledColor.text;
-            _textColorHover = _theme.buttons.warning.disabledColor.text;
-            _textColorPressed = _theme.buttons.warning.disabledColor.text;
-            _borderColor = _theme.buttons.warning.disabledColor.border;
-            _borderColorHover = _theme.buttons.warning.disabledColor.border;
-            _borderColorPressed = _theme.buttons.warning.disabledColor.border;
-            _fillColor = _theme.buttons.warning.disabledColor.fill;
-            _fillColorHover = _theme.buttons.warning.disabledColor.fill;
-            _fillColorPressed = _theme.buttons.warning.disabledColor.fill;
+            _textColor = _theme->buttons.warning.disabledColor.text;
+            _textColorHover = _theme->buttons.warning.disabledColor.text;
+            _textColorPressed = _theme->buttons.warning.disabledColor.text;
+            _borderColor = _theme->buttons.warning.disabledColor.border;
+            _borderColorHover = _theme->buttons.warning.disabledColor.border;
+            _borderColorPressed = _theme->buttons.warning.disabledColor.border;
+            _fillColor = _theme->buttons.warning.disabledColor.fill;
+            _fillColorHover = _theme->buttons.warning.disabledColor.fill;
+            _fillColorPressed = _theme->buttons.warning.disabledColor.fill;
           break;
         case Style::Danger:
-            _textColor = _theme.buttons.danger.disabledColor.text;
-            _textColorHover = _theme.buttons.danger.disabledColor.text;
-            _textColorPressed = _theme.buttons.danger.disabledColor.text;
-            _borderColor = _theme.buttons.danger.disabledColor.border;
-            _borderColorHover = _theme.buttons.danger.disabledColor.border;
-            _borderColorPressed = _theme.buttons.danger.disabledColor.border;
-            _fillColor = _theme.buttons.danger.disabledColor.fill;
-            _fillColorHover = _theme.buttons.danger.disabledColor.fill;
-            _fillColorPressed = _theme.buttons.danger.disabledColor.fill;
+            _textColor = _theme->buttons.danger.disabledColor.text;
+            _textColorHover = _theme->buttons.danger.disabledColor.text;
+            _textColorPressed = _theme->buttons.danger.disabledColor.text;
+            _borderColor = _theme->buttons.danger.disabledColor.border;
+            _borderColorHover = _theme->buttons.danger.disabledColor.border;
+            _borderColorPressed = _theme->buttons.danger.disabledColor.border;
+            _fillColor = _theme->buttons.danger.disabledColor.fill;
+            _fillColorHover = _theme->buttons.danger.disabledColor.fill;
+            _fillColorPressed = _theme->buttons.danger.disabledColor.fill;
           break;
       }
     } else if (_outline) {
       switch (_style) {
         case Style::Primary:
-            _textColor = _theme.buttons.primary.defaultColor.text;
-            _textColorHover = _theme.buttons.primary.hoverColor.text;
-            _textColorPressed = _theme.buttons.primary.pressedColor.text;
-            _borderColor = _theme.buttons.primary.defaultColor.fill;
-            _borderColorHover = _theme.buttons.primary.hoverColor.border;
-            _borderColorPressed = _theme.buttons.primary.pressedColor.border;
-            _fillColor = _theme.buttons.primary.defaultColor.fill;
-            _fillColorHover = _theme.buttons.primary.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.primary.pressedColor.fill;
+            _textColor = _theme->buttons.primary.defaultColor.text;
+            _textColorHover = _theme->buttons.primary.hoverColor.text;
+            _textColorPressed = _theme->buttons.primary.pressedColor.text;
+            _borderColor = _theme->buttons.primary.defaultColor.fill;
+            _borderColorHover = _theme->buttons.primary.hoverColor.border;
+            _borderColorPressed = _theme->buttons.primary.pressedColor.border;
+            _fillColor = _theme->buttons.primary.defaultColor.fill;
+            _fillColorHover = _theme->buttons.primary.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.primary.pressedColor.fill;
           break;
         case Style::Secondary:
-            _textColor = _theme.buttons.secondary.defaultColor.text;
-            _textColorHover = _theme.buttons.secondary.hoverColor.text;
-            _textColorPressed = _theme.buttons.secondary.pressedColor.text;
-            _borderColor = _theme.buttons.secondary.defaultColor.fill;
-            _borderColorHover = _theme.buttons.secondary.hoverColor.border;
-            _borderColorPressed = _theme.buttons.secondary.pressedColor.border;
-            _fillColor = _theme.buttons.secondary.defaultColor.fill;
-            _fillColorHover = _theme.buttons.secondary.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.secondary.pressedColor.fill;
+            _textColor = _theme->buttons.secondary.defaultColor.text;
+            _textColorHover = _theme->buttons.secondary.hoverColor.text;
+            _textColorPressed = _theme->buttons.secondary.pressedColor.text;
+            _borderColor = _theme->buttons.secondary.defaultColor.fill;
+            _borderColorHover = _theme->buttons.secondary.hoverColor.border;
+            _borderColorPressed = _theme->buttons.secondary.pressedColor.border;
+            _fillColor = _theme->buttons.secondary.defaultColor.fill;
+            _fillColorHover = _theme->buttons.secondary.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.secondary.pressedColor.fill;
           break;
         case Style::Info:
-            _textColor = _theme.buttons.info.defaultColor.text;
-            _textColorHover = _theme.buttons.info.hoverColor.text;
-            _textColorPressed = _theme.buttons.info.pressedColor.text;
-            _borderColor = _theme.buttons.info.defaultColor.fill;
-            _borderColorHover = _theme.buttons.info.hoverColor.border;
-            _borderColorPressed = _theme.buttons.info.pressedColor.border;
-            _fillColor = _theme.buttons.info.defaultColor.fill;
-            _fillColorHover = _theme.buttons.info.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.info.pressedColor.fill;
+            _textColor = _theme->buttons.info.defaultColor.text;
+            _textColorHover = _theme->buttons.info.hoverColor.text;
+            _textColorPressed = _theme->buttons.info.pressedColor.text;
+            _borderColor = _theme->buttons.info.defaultColor.fill;
+            _borderColorHover = _theme->buttons.info.hoverColor.border;
+            _borderColorPressed = _theme->buttons.info.pressedColor.border;
+            _fillColor = _theme->buttons.info.defaultColor.fill;
+            _fillColorHover = _theme->buttons.info.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.info.pressedColor.fill;
           break;
         case Style::Warning:
-            _textColor = _theme.buttons.warning.defaultColor.text;
-            _textColorHover = _theme.buttons.warning.hoverColor.text;
-            _textColorPressed = _theme.buttons.warning.pressedColor.text;
-            _borderColor = _theme.buttons.warning.defaultColor.fill;
-            _borderColorHover = _theme.buttons.warning.hoverColor.border;
-            _borderColorPressed = _theme.buttons.warning.pressedColor.border;
-            _fillColor = _theme.buttons.warning.defaultColor.fill;
-            _fillColorHover = _theme.buttons.warning.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.warning.pressedColor.fill;
+            _textColor = _theme->buttons.warning.defaultColor.text;
+            _textColorHover = _theme->buttons.warning.hoverColor.text;
+            _textColorPressed = _theme->buttons.warning.pressedColor.text;
+            _borderColor = _theme->buttons.warning.defaultColor.fill;
+            _borderColorHover = _theme->buttons.warning.hoverColor.border;
+            _borderColorPressed = _theme->buttons.warning.pressedColor.border;
+            _fillColor = _theme->buttons.warning.defaultColor.fill;
+            _fillColorHover = _theme->buttons.warning.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.warning.pressedColor.fill;
           break;
         case Style::Danger:
-            _textColor = _theme.buttons.danger.defaultColor.text;
-            _textColorHover = _theme.buttons.danger.hoverColor.text;
-            _textColorPressed = _theme.buttons.danger.pressedColor.text;
-            _borderColor = _theme.buttons.danger.defaultColor.fill;
-            _borderColorHover = _theme.buttons.danger.hoverColor.border;
-            _borderColorPressed = _theme.buttons.danger.pressedColor.border;
-            _fillColor = _theme.buttons.danger.defaultColor.fill;
-            _fillColorHover = _theme.buttons.danger.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.danger.pressedColor.fill;
+            _textColor = _theme->buttons.danger.defaultColor.text;
+            _textColorHover = _theme->buttons.danger.hoverColor.text;
+            _textColorPressed = _theme->buttons.danger.pressedColor.text;
+            _borderColor = _theme->buttons.danger.defaultColor.fill;
+            _borderColorHover = _theme->buttons.danger.hoverColor.border;
+            _borderColorPressed = _theme->buttons.danger.pressedColor.border;
+            _fillColor = _theme->buttons.danger.defaultColor.fill;
+            _fillColorHover = _theme->buttons.danger.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.danger.pressedColor.fill;
           break;
       }
     } else {
       switch (_style) {
         case Style::Primary:
-            _textColor = _theme.buttons.primary.defaultColor.text;
-            _textColorHover = _theme.buttons.primary.hoverColor.text;
-            _textColorPressed = _theme.buttons.primary.pressedColor.text;
-            _borderColor = _theme.buttons.primary.defaultColor.border;
-            _borderColorHover = _theme.buttons.primary.hoverColor.border;
-            _borderColorPressed = _theme.buttons.primary.pressedColor.border;
-            _fillColor = _theme.buttons.primary.defaultColor.fill;
-            _fillColorHover = _theme.buttons.primary.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.primary.pressedColor.fill;
+            _textColor = _theme->buttons.primary.defaultColor.text;
+            _textColorHover = _theme->buttons.primary.hoverColor.text;
+            _textColorPressed = _theme->buttons.primary.pressedColor.text;
+            _borderColor = _theme->buttons.primary.defaultColor.border;
+            _borderColorHover = _theme->buttons.primary.hoverColor.border;
+            _borderColorPressed = _theme->buttons.primary.pressedColor.border;
+            _fillColor = _theme->buttons.primary.defaultColor.fill;
+            _fillColorHover = _theme->buttons.primary.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.primary.pressedColor.fill;
           break;
         case Style::Secondary:
-            _textColor = _theme.buttons.secondary.defaultColor.text;
-            _textColorHover = _theme.buttons.secondary.hoverColor.text;
-            _textColorPressed = _theme.buttons.secondary.pressedColor.text;
-            _borderColor = _theme.buttons.secondary.defaultColor.border;
-            _borderColorHover = _theme.buttons.secondary.hoverColor.border;
-            _borderColorPressed = _theme.buttons.secondary.pressedColor.border;
-            _fillColor = _theme.buttons.secondary.defaultColor.fill;
-            _fillColorHover = _theme.buttons.secondary.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.secondary.pressedColor.fill;
+            _textColor = _theme->buttons.secondary.defaultColor.text;
+            _textColorHover = _theme->buttons.secondary.hoverColor.text;
+            _textColorPressed = _theme->buttons.secondary.pressedColor.text;
+            _borderColor = _theme->buttons.secondary.defaultColor.border;
+            _borderColorHover = _theme->buttons.secondary.hoverColor.border;
+            _borderColorPressed = _theme->buttons.secondary.pressedColor.border;
+            _fillColor = _theme->buttons.secondary.defaultColor.fill;
+            _fillColorHover = _theme->buttons.secondary.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.secondary.pressedColor.fill;
           break;
         case Style::Info:
-            _textColor = _theme.buttons.info.defaultColor.text;
-            _textColorHover = _theme.buttons.info.hoverColor.text;
-            _textColorPressed = _theme.buttons.info.pressedColor.text;
-            _borderColor = _theme.buttons.info.defaultColor.border;
-            _borderColorHover = _theme.buttons.info.hoverColor.border;
-            _borderColorPressed = _theme.buttons.info.pressedColor.border;
-            _fillColor = _theme.buttons.info.defaultColor.fill;
-            _fillColorHover = _theme.buttons.info.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.info.pressedColor.fill;
+            _textColor = _theme->buttons.info.defaultColor.text;
+            _textColorHover = _theme->buttons.info.hoverColor.text;
+            _textColorPressed = _theme->buttons.info.pressedColor.text;
+            _borderColor = _theme->buttons.info.defaultColor.border;
+            _borderColorHover = _theme->buttons.info.hoverColor.border;
+            _borderColorPressed = _theme->buttons.info.pressedColor.border;
+            _fillColor = _theme->buttons.info.defaultColor.fill;
+            _fillColorHover = _theme->buttons.info.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.info.pressedColor.fill;
           break;
         case Style::Warning:
-            _textColor = _theme.buttons.warning.defaultColor.text;
-            _textColorHover = _theme.buttons.warning.hoverColor.text;
-            _textColorPressed = _theme.buttons.warning.pressedColor.text;
-            _borderColor = _theme.buttons.warning.defaultColor.border;
-            _borderColorHover = _theme.buttons.warning.hoverColor.border;
-            _borderColorPressed = _theme.buttons.warning.pressedColor.border;
-            _fillColor = _theme.buttons.warning.defaultColor.fill;
-            _fillColorHover = _theme.buttons.warning.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.warning.pressedColor.fill;
+            _textColor = _theme->buttons.warning.defaultColor.text;
+            _textColorHover = _theme->buttons.warning.hoverColor.text;
+            _textColorPressed = _theme->buttons.warning.pressedColor.text;
+            _borderColor = _theme->buttons.warning.defaultColor.border;
+            _borderColorHover = _theme->buttons.warning.hoverColor.border;
+            _borderColorPressed = _theme->buttons.warning.pressedColor.border;
+            _fillColor = _theme->buttons.warning.defaultColor.fill;
+            _fillColorHover = _theme->buttons.warning.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.warning.pressedColor.fill;
           break;
         case Style::Danger:
-            _textColor = _theme.buttons.danger.defaultColor.text;
-            _textColorHover = _theme.buttons.danger.hoverColor.text;
-            _textColorPressed = _theme.buttons.danger.pressedColor.text;
-            _borderColor = _theme.buttons.danger.defaultColor.border;
-            _borderColorHover = _theme.buttons.danger.hoverColor.border;
-            _borderColorPressed = _theme.buttons.danger.pressedColor.border;
-            _fillColor = _theme.buttons.danger.defaultColor.fill;
-            _fillColorHover = _theme.buttons.danger.hoverColor.fill;
-            _fillColorPressed = _theme.buttons.danger.pressedColor.fill;
+            _textColor = _theme->buttons.danger.defaultColor.text;
+            _textColorHover = _theme->buttons.danger.hoverColor.text;
+            _textColorPressed = _theme->buttons.danger.pressedColor.text;
+            _borderColor = _theme->buttons.danger.defaultColor.border;
+            _borderColorHover = _theme->buttons.danger.hoverColor.border;
+            _borderColorPressed = _theme->buttons.danger.pressedColor.border;
+            _fillColor = _theme->buttons.danger.defaultColor.fill;
+            _fillColorHover = _theme->buttons.danger.hoverColor.fill;
+            _fillColorPressed = _theme->buttons.danger.pressedColor.fill;
           break;
       }
     }
+    _invalidate();
   }
 
-  void FlatButton::setTheme(std::string name)
+  void FlatButton::_setTheme(const Theme* theme)
   {
-    _theme = _getTheme(name);
+    Widget::_setTheme(theme);
     setStyle(_style);
   }
 
@@ -322,7 +320,8 @@ namespace SGI {
       return;
     }
 
-    if (_textTexture == nullptr && !_label.empty()) {
+    bool hasLabel = FontBook::isGlyphAtlasEnabled() ? _textWidth > 0 : _textTexture != nullptr;
+    if (!hasLabel && !_label.empty()) {
       _updateLabel();
     }
 
@@ -348,37 +347,45 @@ namespace SGI {
 
 
     if (_mouseButtonState[1]) {
-      SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+      _setClipRect(&_bounds);
       _drawRoundedRect(getRenderer().get(), _bounds, _borderColorPressed, _fillColorPressed, true, 1, _radius);
-      SDL_SetRenderClipRect(getRenderer().get(), &ca);
-      SDL_RenderTexture(getRenderer().get(), _textTexturePressed, NULL, &labelPos);
+      _setClipRect(&ca);
+      _renderLabel(_textColorPressed, labelPos);
       if (!_icon.empty()) {
-        SDL_SetTextureColorMod(_root->getTexture(_icon)->texture.get(), _textColorPressed.r, _textColorPressed.g, _textColorPressed.b);
-        _root->renderTexture(_icon, iconPos);
+        _root->renderTexture(_icon, iconPos, 0.0, 1.0, _textColorPressed);
       }
     } else if (isMouseOver()) {
-      SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+      _setClipRect(&_bounds);
       _drawRoundedRect(getRenderer().get(), _bounds, _borderColorHover, _fillColorHover, true, 1, _radius);
-      SDL_SetRenderClipRect(getRenderer().get(), &ca);
-      SDL_RenderTexture(getRenderer().get(), _textTextureHover, NULL, &labelPos);
+      _setClipRect(&ca);
+      _renderLabel(_textColorHover, labelPos);
       if (!_icon.empty()) {
-        SDL_SetTextureColorMod(_root->getTexture(_icon)->texture.get(), _textColorHover.r, _textColorHover.g, _textColorHover.b);
-        _root->renderTexture(_icon, iconPos);
+        _root->renderTexture(_icon, iconPos, 0.0, 1.0, _textColorHover);
       }
     } else {
-      SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+      _setClipRect(&_bounds);
       _drawRoundedRect(getRenderer().get(), _bounds, _borderColor, _fillColor, !_outline, 1, _radius);
-      SDL_SetRenderClipRect(getRenderer().get(), &ca);
-      SDL_RenderTexture(getRenderer().get(), _textTexture, NULL, &labelPos);
+      _setClipRect(&ca);
+      _renderLabel(_textColor, labelPos);
       if (!_icon.empty()) {
-        SDL_SetTextureColorMod(_root->getTexture(_icon)->texture.get(), _textColor.r, _textColor.g, _textColor.b);
-        _root->renderTexture(_icon, iconPos);
+        _root->renderTexture(_icon, iconPos, 0.0, 1.0, _textColor);
       }
     }
   }
 
+  void FlatButton::_renderLabel(SDL_Color color, SDL_FRect& position)
+  {
+    if (FontBook::isGlyphAtlasEnabled()) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _label, color, position.x, position.y);
+      return;
+    }
+
+    _renderTexture(_textTexture, nullptr, position, color);
+  }
+
   void FlatButton::_updateLabel()
   {
+    _invalidate();
     if (getRenderer() == nullptr) {
       return;
     }
@@ -404,39 +411,23 @@ namespace SGI {
     _textHeight = 0;
     _textWidth = 0;
 
-    if (!_label.empty()) {
-      std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, _textColor);
-      if(!textSurface) {
-        ERROR(FLATBUTTON, "Surface not created: %s", SDL_GetError());
-        return;
-      }
-
-      _textTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
-      if (!_textTexture) {
-        ERROR(FLATBUTTON, "Texture not created: %s", SDL_GetError());
-        return;
-      }
-
-      textSurface = FontBook::render(_fontName, _fontSize, _label, _textColorHover);
-      if(!textSurface) {
-        ERROR(FLATBUTTON, "Surface not created: %s", SDL_GetError());
-        return;
-      }
-
-      _textTextureHover = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
-      if (!_textTextureHover) {
-        ERROR(FLATBUTTON, "Texture not created: %s", SDL_GetError());
+    if (!_label.empty() && FontBook::isGlyphAtlasEnabled()) {
+      int width;
+      int height;
+      if (!FontBook::measure(_fontName, _fontSize, _label, &width, &height)) {
         return;
       }
-
-      textSurface = FontBook::render(_fontName, _fontSize, _label, _textColorPressed);
+      _textWidth = width;
+      _textHeight = height;
+    } else if (!_label.empty()) {
+      std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, TINT_WHITE);
       if(!textSurface) {
         ERROR(FLATBUTTON, "Surface not created: %s", SDL_GetError());
         return;
       }
 
-      _textTexturePressed = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
-      if (!_textTexturePressed) {
+      _textTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
+      if (!_textTexture) {
         ERROR(FLATBUTTON, "Texture not created: %s", SDL_GetError());
         return;
       }
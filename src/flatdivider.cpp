@@ -44,6 +44,7 @@ namespace SGI {
       }
       _dirty = true;
     }
+    _invalidate();
   }
 
   void FlatDivider::setSize(int value)
@@ -59,12 +60,13 @@ namespace SGI {
       }
       _dirty = true;
     }
+    _invalidate();
   }
 
-  void FlatDivider::setTheme(std::string name)
+  void FlatDivider::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _borderColor = theme.colors.borderColor;
+    Widget::_setTheme(theme);
+    _borderColor = theme->colors.borderColor;
   }
   
   void FlatDivider::_render(double deltaTime)
@@ -88,10 +90,9 @@ namespace SGI {
       line.h = ca.h;
     }
   
-    SDL_SetRenderClipRect(getRenderer().get(), &ca);
-    SDL_SetRenderDrawColor(getRenderer().get(), _borderColor.r, _borderColor.g, _borderColor.b, _borderColor.a);
-    SDL_RenderFillRect(getRenderer().get(), &line);
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    _setClipRect(&ca);
+    _fillRect(line, _borderColor);
+    _setClipRect(nullptr);
 
     Widget::_render(deltaTime);
   }
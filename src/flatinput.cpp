@@ -5,6 +5,7 @@
 #include "debug.h"
 #include "flatinput.h"
 #include "fontbook.h"
+#include "profiler.h"
 #include "window.h"
 
 namespace SGI {
@@ -25,21 +26,14 @@ namespace SGI {
     }
   }
 
-  std::string FlatInput::addChangeListener(const Widget::Callback& handler)
+  Uint64 FlatInput::addChangeListener(const Widget::Callback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_changeHandelers.find(id) != _changeHandelers.end());
-    _changeHandelers[id] = handler;
-
-    return id;
+    return _changeListeners.add(handler);
   }
 
-  void FlatInput::removeChangeListener(const std::string& id)
+  void FlatInput::removeChangeListener(Uint64 handle)
   {
-    _changeHandelers.erase(id);
+    _changeListeners.remove(handle);
   }
 
   std::string FlatInput::getFontName()
@@ -133,10 +127,8 @@ namespace SGI {
             _value.erase(_cursorIndex, 1);
             _updateLabel();
 
-            for (const auto& [id, handler] : _changeHandelers) {
-              if (handler(_root, _self)) {
-                ret = true;
-              }
+            if (_changeListeners.call(_root, _self)) {
+              ret = true;
             }
           }
         }
@@ -174,10 +166,8 @@ namespace SGI {
         _cursorIndex += 1;
         _updateLabel();
 
-        for (const auto& [id, handler] : _changeHandelers) {
-          if (handler(_root, _self)) {
-            ret = true;
-          }
+        if (_changeListeners.call(_root, _self)) {
+          ret = true;
         }
         break;
       }
@@ -191,15 +181,18 @@ namespace SGI {
 
   void FlatInput::setBorderColor(const SDL_Color &color) {
     _borderColor = color;
+    _invalidate();
   }
 
   void FlatInput::setFillColor(const SDL_Color &color) {
     _fillColor = color;
+    _invalidate();
   }
 
   void FlatInput::setSelectColor(const SDL_Color &color)
   {
     _selectColor = color;
+    _invalidate();
   }
 
   void FlatInput::setFontName(const std::string& fontName)
@@ -225,6 +218,7 @@ namespace SGI {
     }
 
     _radius = value;
+    _invalidate();
   }
 
   void FlatInput::setValue(const std::string& value)
@@ -235,13 +229,13 @@ namespace SGI {
     }
   }
 
-  void FlatInput::setTheme(std::string name)
+  void FlatInput::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _textColor = theme.colors.textColor;
-    _borderColor = theme.colors.borderColor;
-    _fillColor = theme.colors.fillColor;
-    _selectColor = theme.colors.textSelectColor;
+    Widget::_setTheme(theme);
+    _textColor = theme->colors.textColor;
+    _borderColor = theme->colors.borderColor;
+    _fillColor = theme->colors.fillColor;
+    _selectColor = theme->colors.textSelectColor;
     _updateLabel();
   }
   
@@ -251,7 +245,7 @@ namespace SGI {
       return;
     }
 
-    if (!_textTexture) {
+    if (!_textTexture && !FontBook::isGlyphAtlasEnabled()) {
       _updateLabel();
     }
 
@@ -261,12 +255,14 @@ namespace SGI {
       _textureOffset = 0;
     }
 
-    SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+    // The cursor blinks while focused
+    _setAnimating(_focused);
+
+    _setClipRect(&_bounds);
     _drawRoundedRect(getRenderer().get(), _bounds, _borderColor, _fillColor, true, 1, _radius);
 
     if (_selectStart != -1 && _selectEnd != -1 && _selectStart != _selectEnd) {
-      SDL_SetRenderDrawColor(getRenderer().get(), _selectColor.r, _selectColor.g, _selectColor.b, _selectColor.a);
-      SDL_RenderFillRect(getRenderer().get(), &_selectRect);
+      _fillRect(_selectRect, _selectColor);
     }
 
     SDL_Rect ca = getContentArea();
@@ -290,8 +286,7 @@ namespace SGI {
     cursorRect.h = ca.h;
 
     if (_focused && _cursorBlink) {
-      SDL_SetRenderDrawColor(getRenderer().get(), _textColor.r, _textColor.g, _textColor.b, _textColor.a);
-      SDL_RenderRect(getRenderer().get(), &cursorRect);
+      _fillRect(cursorRect, _textColor);
     }
 
     _cursorTime += deltaTime;
@@ -300,9 +295,13 @@ namespace SGI {
       _cursorTime = 0;
     }
     
-    SDL_SetRenderClipRect(getRenderer().get(), &ca);
-    SDL_RenderTexture(getRenderer().get(), _textTexture, NULL, &position);
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    _setClipRect(&ca);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _value, _textColor, position.x, position.y);
+    } else {
+      _renderTexture(_textTexture, nullptr, position);
+    }
+    _setClipRect(nullptr);
 
     Widget::_render(deltaTime);
   }
@@ -360,6 +359,7 @@ namespace SGI {
 
   void FlatInput::_updateLabel()
   {
+    _invalidate();
     if (getRenderer() == nullptr) {
       return;
     }
@@ -373,25 +373,35 @@ namespace SGI {
       return;
     }
 
-    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _value, _textColor);
-    if(!textSurface) {
-      ERROR(FLATLABEL, "Surface not created: %s", SDL_GetError());
-      return;
-    }
+    if (FontBook::isGlyphAtlasEnabled()) {
+      int width, height;
+      if (!FontBook::measure(_fontName, _fontSize, _value, &width, &height)) {
+        return;
+      }
+      _textWidth = width;
+      _textHeight = height;
+    } else {
+      std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _value, _textColor);
+      if(!textSurface) {
+        ERROR(FLATLABEL, "Surface not created: %s", SDL_GetError());
+        return;
+      }
 
-    _textTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
-    if (!_textTexture) {
-      ERROR(FLATLABEL, "Texture not created: %s", SDL_GetError());
-      return;
-    }
+      _textTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
+      if (!_textTexture) {
+        ERROR(FLATLABEL, "Texture not created: %s", SDL_GetError());
+        return;
+      }
 
-    SDL_GetTextureSize(_textTexture, &_textWidth, &_textHeight);
+      SDL_GetTextureSize(_textTexture, &_textWidth, &_textHeight);
+    }
 
     _updatePosition();
   }
 
   void FlatInput::_updatePosition()
   {
+    _invalidate();
     std::string check = _value.substr(0, _cursorIndex);
     if (check.length() > 0) {
       int count;
@@ -5,6 +5,7 @@
 #include "debug.h"
 #include "flatlabel.h"
 #include "fontbook.h"
+#include "profiler.h"
 
 namespace SGI {
   std::shared_ptr<FlatLabel> FlatLabel::create()
@@ -70,6 +71,7 @@ namespace SGI {
   void FlatLabel::setJustification(FlatLabel::TextJustification justification)
   {
     _justification = justification;
+    _invalidate();
   }
 
   void FlatLabel::setLabel(const std::string& value)
@@ -80,10 +82,10 @@ namespace SGI {
     }
   }
 
-  void FlatLabel::setTheme(std::string name)
+  void FlatLabel::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _textColor = theme.colors.textColor;
+    Widget::_setTheme(theme);
+    _textColor = theme->colors.textColor;
     _updateLabel();
   }
   
@@ -93,7 +95,7 @@ namespace SGI {
       return;
     }
 
-    if (!_textTexture) {
+    if (!_textTexture && !FontBook::isGlyphAtlasEnabled()) {
       _updateLabel();
     }
 
@@ -110,15 +112,20 @@ namespace SGI {
     labelPos.h = _textHeight;
     labelPos.w = _textWidth;
 
-    SDL_SetRenderClipRect(getRenderer().get(), &ca);
-    SDL_RenderTexture(getRenderer().get(), _textTexture, NULL, &labelPos);
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    _setClipRect(&ca);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _label, _textColor, labelPos.x, labelPos.y);
+    } else {
+      _renderTexture(_textTexture, nullptr, labelPos);
+    }
+    _setClipRect(nullptr);
 
     Widget::_render(deltaTime);
   }
 
   void FlatLabel::_updateLabel()
   {
+    _invalidate();
     if (getRenderer() == nullptr) {
       return;
     }
@@ -132,19 +139,28 @@ namespace SGI {
       return;
     }
 
-    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, _textColor);
-    if(!textSurface) {
-      ERROR(FLATLABEL, "Surface not created: %s", SDL_GetError());
-      return;
-    }
-
-    _textTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
-    if (!_textTexture) {
-      ERROR(FLATLABEL, "Texture not created: %s", SDL_GetError());
-      return;
+    if (FontBook::isGlyphAtlasEnabled()) {
+      int width, height;
+      if (!FontBook::measure(_fontName, _fontSize, _label, &width, &height)) {
+        return;
+      }
+      _textWidth = width;
+      _textHeight = height;
+    } else {
+      std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, _textColor);
+      if(!textSurface) {
+        ERROR(FLATLABEL, "Surface not created: %s", SDL_GetError());
+        return;
+      }
+
+      _textTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
+      if (!_textTexture) {
+        ERROR(FLATLABEL, "Texture not created: %s", SDL_GetError());
+        return;
+      }
+
+      SDL_GetTextureSize(_textTexture, &_textWidth, &_textHeight);
     }
-
-    SDL_GetTextureSize(_textTexture, &_textWidth, &_textHeight);
     _constraints.width.preferredValue = _textWidth + _padding.left + _padding.right;
     _constraints.height.preferredValue = _textHeight + _padding.top + _padding.bottom;
     _dirty = true;
@@ -5,6 +5,7 @@
 #include "debug.h"
 #include "flatoption.h"
 #include "fontbook.h"
+#include "profiler.h"
 
 namespace SGI {
   std::shared_ptr<FlatOption> FlatOption::create()
@@ -31,21 +32,14 @@ namespace SGI {
     }
   }
 
-  std::string FlatOption::addChangeListener(const Widget::Callback& handler)
+  Uint64 FlatOption::addChangeListener(const Widget::Callback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_changeHandelers.find(id) != _changeHandelers.end());
-    _changeHandelers[id] = handler;
-
-    return id;
+    return _changeListeners.add(handler);
   }
 
-  void FlatOption::removeChangeListener(const std::string& id)
+  void FlatOption::removeChangeListener(Uint64 handle)
   {
-    _changeHandelers.erase(id);
+    _changeListeners.remove(handle);
   }
 
   std::string FlatOption::getFontName()
@@ -75,11 +69,10 @@ namespace SGI {
       case SDL_EVENT_MOUSE_BUTTON_DOWN: {
         if (isMouseOver()) {
           _value = !_value;
+          _invalidate();
 
-          for (const auto& [id, handler] : _changeHandelers) {
-            if (handler(_root, _self)) {
-              ret = true;
-            }
+          if (_changeListeners.call(_root, _self)) {
+            ret = true;
           }
         }
       }
@@ -117,15 +110,15 @@ namespace SGI {
     if (value != _value) {
       _value = value;
     }
+    _invalidate();
   }
 
-  void FlatOption::setTheme(std::string name)
+  void FlatOption::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _textColor = theme.colors.textColor;
-    _borderColor = theme.colors.accentBorderColor;
-    _fillColor = theme.colors.accentFillColor;
-    _updateLabel();
+    Widget::_setTheme(theme);
+    _textColor = theme->colors.textColor;
+    _borderColor = theme->colors.accentBorderColor;
+    _fillColor = theme->colors.accentFillColor;
   }
 
   void FlatOption::_render(double deltaTime)
@@ -134,7 +127,7 @@ namespace SGI {
       return;
     }
 
-    if (!_textTexture) {
+    if (!_textTexture && !FontBook::isGlyphAtlasEnabled()) {
       _updateLabel();
     }
 
@@ -159,19 +152,24 @@ namespace SGI {
     optionValueRect.w = optionSize - 8;
     optionValueRect.h = optionSize - 8;
 
-    SDL_SetRenderClipRect(getRenderer().get(), &ca);
+    _setClipRect(&ca);
     _drawRoundedRect(getRenderer().get(), optionRect, _borderColor, _textColor, false, 1, optionRect.w / 2);
     if (_value) {
       _drawRoundedRect(getRenderer().get(), optionValueRect, _fillColor, _fillColor, true, 1, optionValueRect.w / 2 - 1);
     }
-    SDL_RenderTexture(getRenderer().get(), _textTexture, NULL, &labelPos);
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _label, _textColor, labelPos.x, labelPos.y);
+    } else {
+      _renderTexture(_textTexture, nullptr, labelPos, _textColor);
+    }
+    _setClipRect(nullptr);
 
     Widget::_render(deltaTime);
   }
 
   void FlatOption::_updateLabel()
   {
+    _invalidate();
     if (getRenderer() == nullptr) {
       return;
     }
@@ -185,13 +183,23 @@ namespace SGI {
       return;
     }
 
-    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, _textColor);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      int width, height;
+      if (!FontBook::measure(_fontName, _fontSize, _label, &width, &height)) {
+        return;
+      }
+      _textWidth = width;
+      _textHeight = height;
+      return;
+    }
+
+    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _label, TINT_WHITE);
     if(!textSurface) {
       ERROR(FLATLABEL, "Surface not created: %s", SDL_GetError());
       return;
     }
 
-    _textTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
+    _textTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
     if (!_textTexture) {
       ERROR(FLATLABEL, "Texture not created: %s", SDL_GetError());
       return;
@@ -17,15 +17,18 @@ namespace SGI {
 
   void FlatPanel::setBorderColor(const SDL_Color &color) {
     _borderColor = color;
+    _invalidate();
   }
 
   void FlatPanel::setFillColor(const SDL_Color &color) {
     _fillColor = color;
+    _invalidate();
   }
 
   void FlatPanel::setOutline(bool value)
   {
     _outline = value;
+    _invalidate();
   }
 
   void FlatPanel::setRadius(int value)
@@ -35,13 +38,19 @@ namespace SGI {
     }
 
     _radius = value;
+    _invalidate();
   }
 
-  void FlatPanel::setTheme(std::string name)
+  void FlatPanel::setTheme(const std::string& name)
   {
-    Flat::Theme theme = _getTheme(name);
-    _borderColor = theme.colors.borderColor;
-    _fillColor = theme.colors.backgroundColor;
+    Container::setTheme(name);
+  }
+
+  void FlatPanel::_setTheme(const Theme* theme)
+  {
+    Container::_setTheme(theme);
+    _borderColor = theme->colors.borderColor;
+    _fillColor = theme->colors.backgroundColor;
   }
   
   void FlatPanel::_render(double deltaTime)
@@ -50,7 +59,7 @@ namespace SGI {
       return;
     }
 
-    SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+    _setClipRect(&_bounds);
     _drawRoundedRect(getRenderer().get(), _bounds, _borderColor, _fillColor, !_outline, 1, _radius);
 
     Container::_render(deltaTime);
@@ -3,8 +3,10 @@
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include "debug.h"
+#include "drawlist.h"
 #include "flatselect.h"
 #include "fontbook.h"
+#include "profiler.h"
 #include "window.h"
 
 namespace SGI {
@@ -29,21 +31,14 @@ namespace SGI {
     }
   }
 
-  std::string FlatSelect::addChangeListener(const Widget::Callback& handler)
+  Uint64 FlatSelect::addChangeListener(const Widget::Callback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_inputHandelers.find(id) != _inputHandelers.end());
-    _inputHandelers[id] = handler;
-
-    return id;
+    return _changeListeners.add(handler);
   }
 
-  void FlatSelect::removeChangeListener(const std::string& id)
+  void FlatSelect::removeChangeListener(Uint64 handle)
   {
-    _inputHandelers.erase(id);
+    _changeListeners.remove(handle);
   }
 
   std::string FlatSelect::getFontName()
@@ -66,9 +61,13 @@ namespace SGI {
     if (event->type == SDL_EVENT_MOUSE_BUTTON_UP) {
       if (isMouseOver()) {
         _opened = !_opened;
+        _setPointerCapture(_opened);
+        _invalidateOverlay();
         return true;
       } else if (_opened && !_isMouseOverOverlay()) {
         _opened = false;
+        _setPointerCapture(false);
+        _invalidateOverlay();
       }
     } else if (event->type == SDL_EVENT_MOUSE_WHEEL && _opened) {
       if (_isMouseOverOverlay() && _optionsHeight > _optionsContent.h) {
@@ -80,33 +79,28 @@ namespace SGI {
           _optionsScrollOffset = _optionsHeight - _optionsContent.h;
         }
         _updateSelected();
+        _invalidateOverlay();
         return true;
       }
     } else if (event->type == SDL_EVENT_MOUSE_MOTION) {
       if (_isMouseOverOverlay()) {
         _updateSelected();
         return true;
-      } else {
+      } else if (_mouseOverOptionIndex != -1) {
         _mouseOverOptionIndex = -1;
+        _invalidateOverlay();
       }
     } else if (event->type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
       if (_opened && _isMouseOverOverlay() && _mouseOverOptionIndex != -1) {
         _value = _options[_mouseOverOptionIndex];
         _updateLabel();
+        _invalidateOverlay();
         _opened = false;
+        _setPointerCapture(false);
         _mouseOverOptionIndex = -1;
         _optionsScrollOffset = 0;
 
-        bool stop = false;
-        for (const auto& [id, handler] : _inputHandelers) {
-          if (!stop) {
-            if (handler(_root, _self)) {
-              stop = true;
-            }
-          }
-        }
-
-        return stop;
+        return _changeListeners.callUntilHandled(_root, _self);
       }
     }
     return Widget::processEvent(event);
@@ -115,17 +109,17 @@ namespace SGI {
 
   void FlatSelect::setBorderColor(const SDL_Color &color) {
     _borderColor = color;
+    _invalidate();
   }
 
   void FlatSelect::setFillColor(const SDL_Color &color) {
     _fillColor = color;
+    _invalidate();
   }
 
   void FlatSelect::setFontColor(const SDL_Color &color) {
     _textColor = color;
-    _updateLabel();
-    _updateNoOptionsLadel();
-    _updateOptionsLadel();
+    _invalidateOverlay();
   }
 
   void FlatSelect::setFontName(const std::string& fontName)
@@ -134,6 +128,7 @@ namespace SGI {
     _updateLabel();
     _updateNoOptionsLadel();
     _updateOptionsLadel();
+    _invalidateOverlay();
   }
 
   void FlatSelect::setFontSize(double fontSize)
@@ -146,6 +141,7 @@ namespace SGI {
     _updateLabel();
     _updateNoOptionsLadel();
     _updateOptionsLadel();
+    _invalidateOverlay();
   }
 
   void FlatSelect::setNoOptionsLabel(const std::string &value)
@@ -156,6 +152,7 @@ namespace SGI {
       _noOptionsText = value;
     }
     _updateNoOptionsLadel();
+    _invalidateOverlay();
   }
 
   void FlatSelect::setOptions(const std::vector<std::string>& options)
@@ -163,6 +160,7 @@ namespace SGI {
     _options = options;
     setValue(_options[0]);
     _updateOptionsLadel();
+    _invalidateOverlay();
   }
 
   void FlatSelect::setRadius(int value)
@@ -171,6 +169,7 @@ namespace SGI {
       return;
     }
     _radius = value;
+    _invalidate();
   }
 
   void FlatSelect::setValue(const std::string& value)
@@ -181,14 +180,23 @@ namespace SGI {
     }
   }
 
-  void FlatSelect::setTheme(std::string name)
+  void FlatSelect::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _textColor = theme.colors.textColor;
-    _borderColor = theme.colors.borderColor;
-    _fillColor = theme.colors.fillColor;
-    _updateLabel();
-    _updateOptionsLadel();
+    Widget::_setTheme(theme);
+    _textColor = theme->colors.textColor;
+    _borderColor = theme->colors.borderColor;
+    _fillColor = theme->colors.fillColor;
+    _invalidateOverlay();
+  }
+
+  void FlatSelect::_invalidateOverlay()
+  {
+    _invalidate();
+    _invalidate(_optionsBounds);
+    if (_opened) {
+      _updateOptionsBounds();
+      _invalidate(_optionsBounds);
+    }
   }
 
   bool FlatSelect::_isMouseOverOverlay()
@@ -208,7 +216,8 @@ namespace SGI {
       return;
     }
 
-    if (_valueTexture == nullptr && !_value.empty()) {
+    bool hasValue = FontBook::isGlyphAtlasEnabled() ? _valueWidth > 0 : _valueTexture != nullptr;
+    if (!hasValue && !_value.empty()) {
       _updateLabel();
     }
 
@@ -225,19 +234,23 @@ namespace SGI {
     labelClip.w = ca.w - ca.h - _padding.right;
     labelClip.h = ca.h;
 
-    SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+    _setClipRect(&_bounds);
     _drawRoundedRect(getRenderer().get(), _bounds, _borderColor, _fillColor, true, 1, _radius);
-    SDL_SetRenderDrawColor(getRenderer().get(), _borderColor.r, _borderColor.g, _borderColor.b, _borderColor.a);
-    SDL_RenderLine(getRenderer().get(), ca.x + ca.w - ca.h, ca.y, ca.x + ca.w - ca.h, ca.y + ca.h);
+    SDL_FRect divider = {static_cast<float>(ca.x + ca.w - ca.h), static_cast<float>(ca.y), 1, static_cast<float>(ca.h)};
+    _fillRect(divider, _borderColor);
 
     SDL_Point center;
     center.x = ca.x + ca.w - (ca.h / 2) + (_padding.right / 2);
     center.y = ca.y + (ca.h / 2);
     _drawChevron(getRenderer().get(), center, ca.h / 3 * 2, _opened ? 0 : 180, _borderColor, _borderColor, true, 1);
 
-    SDL_SetRenderClipRect(getRenderer().get(), &labelClip);
-    SDL_RenderTexture(getRenderer().get(), _valueTexture, NULL, &labelPos);
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    _setClipRect(&labelClip);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _value, _textColor, labelPos.x, labelPos.y);
+    } else {
+      _renderTexture(_valueTexture, nullptr, labelPos, _textColor);
+    }
+    _setClipRect(nullptr);
 
     Widget::_render(deltaTime);
   }
@@ -252,34 +265,11 @@ namespace SGI {
       return;
     }
 
-    if (_noOptionsTexture == nullptr && !_noOptionsText.empty()) {
-      _updateNoOptionsLadel();
-    }
-
-    if (_optionsTexture == nullptr && !_options.empty()) {
-      _updateOptionsLadel();
-    }
-
-    _optionsBounds.x = _bounds.x;
-    _optionsBounds.y = _bounds.y + _bounds.h;
-    _optionsBounds.w = _bounds.w;
-
-    if (_options.size() == 0) {
-      _optionsBounds.h = _noOptionsHeight;
-    } else {
-      int displayItems = (_options.size() < 5 ? _options.size() : 5);
-      _optionsBounds.h = _optionItemHeight * displayItems + ((displayItems - 1) * _optionItemSpace);
-    }
-    _optionsBounds.h += _padding.top + _padding.bottom;
+    _updateOptionsBounds();
 
-    SDL_SetRenderClipRect(getRenderer().get(), &_optionsBounds);
+    _setClipRect(&_optionsBounds);
     _drawRoundedRect(getRenderer().get(), _optionsBounds, _borderColor, _fillColor, true, 1, _radius);
 
-    _optionsContent.x = _optionsBounds.x + _padding.left;
-    _optionsContent.y = _optionsBounds.y + _padding.top;
-    _optionsContent.w = _optionsBounds.w - _padding.left - _padding.right;
-    _optionsContent.h = _optionsBounds.h - _padding.top - _padding.bottom;
-
     SDL_FRect optionsPos;
     optionsPos.x = _optionsContent.x;
     optionsPos.y = _optionsContent.y - (int)_optionsScrollOffset;
@@ -293,16 +283,33 @@ namespace SGI {
       highlight.w = _optionsContent.w + (_padding.left / 2) + (_padding.right / 2);
       highlight.h = _optionItemHeight;
 
-      SDL_SetRenderDrawColor(getRenderer().get(), _borderColor.r, _borderColor.g, _borderColor.b, _borderColor.a);
-      SDL_RenderFillRect(getRenderer().get(), &highlight);
+      _fillRect(highlight, _borderColor);
+    }
+
+    _setClipRect(&_optionsContent);
+    if (!FontBook::isGlyphAtlasEnabled()) {
+      _renderTexture(_options.size() == 0 ? _noOptionsTexture : _optionsTexture, nullptr, optionsPos, _textColor);
+      return;
+    }
+
+    if (_options.size() == 0) {
+      FontBook::draw(getRenderer().get(), _fontName, _fontSize, _noOptionsText, _textColor, optionsPos.x, optionsPos.y);
+      return;
     }
 
-    SDL_SetRenderClipRect(getRenderer().get(), &_optionsContent);
-    SDL_RenderTexture(getRenderer().get(), _options.size() == 0 ? _noOptionsTexture : _optionsTexture, NULL, &optionsPos);
+    // Only draw the options that are scrolled into view
+    float currentY = optionsPos.y;
+    for (size_t i = 0; i < _options.size(); ++i) {
+      if (currentY + _optionItemHeight >= _optionsContent.y && currentY <= _optionsContent.y + _optionsContent.h) {
+        FontBook::draw(getRenderer().get(), _fontName, _fontSize, _options[i], _textColor, optionsPos.x, currentY);
+      }
+      currentY += _optionItemHeight + _optionItemSpace;
+    }
   }
 
   void FlatSelect::_updateLabel()
   {
+    _invalidate();
     if (_valueTexture != nullptr) {
       SDL_DestroyTexture(_valueTexture);
     }
@@ -318,13 +325,22 @@ namespace SGI {
       return;
     }
 
-    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _value, _textColor);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      int width, height;
+      if (FontBook::measure(_fontName, _fontSize, _value, &width, &height)) {
+        _valueWidth = width;
+        _valueHeight = height;
+      }
+      return;
+    }
+
+    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _value, TINT_WHITE);
     if(!textSurface) {
       ERROR(FlatSelect, "Surface not created: %s", SDL_GetError());
       return;
     }
 
-    _valueTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
+    _valueTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
     if (!_valueTexture) {
       ERROR(FlatSelect, "Texture not created: %s", SDL_GetError());
       return;
@@ -350,13 +366,22 @@ namespace SGI {
       return;
     }
 
-    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _noOptionsText, _textColor);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      int width, height;
+      if (FontBook::measure(_fontName, _fontSize, _noOptionsText, &width, &height)) {
+        _noOptionsWidth = width;
+        _noOptionsHeight = height;
+      }
+      return;
+    }
+
+    std::shared_ptr<SDL_Surface> textSurface = FontBook::render(_fontName, _fontSize, _noOptionsText, TINT_WHITE);
     if(!textSurface) {
       ERROR(FlatSelect, "Surface not created: %s", SDL_GetError());
       return;
     }
 
-    _noOptionsTexture = SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get());
+    _noOptionsTexture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), textSurface.get()));
     if (!_noOptionsTexture) {
       ERROR(FlatSelect, "No options texture not created: %s", SDL_GetError());
       return;
@@ -398,20 +423,31 @@ namespace SGI {
       }
     }
 
-    _optionsTexture = SDL_CreateTexture(getRenderer().get(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, _optionsWidth, _optionsHeight);
+    if (FontBook::isGlyphAtlasEnabled()) {
+      return;
+    }
+
+    _optionsTexture = Profiler::trackTexture(SDL_CreateTexture(getRenderer().get(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, _optionsWidth, _optionsHeight));
     if (!_optionsTexture) {
       ERROR(FlatSelect, "No options texture not created: %s", SDL_GetError());
       return;
     }
 
+    // The options are drawn straight into their own texture
+    DrawList* drawList = DrawList::get(getRenderer().get());
+    if (drawList) {
+      drawList->flush();
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(getRenderer().get());
     SDL_SetRenderTarget(getRenderer().get(), _optionsTexture);
     SDL_SetRenderDrawColor(getRenderer().get(), 0, 0, 0, 0);
     SDL_RenderClear(getRenderer().get());
 
     float currentY = 0;
     for (size_t i = 0; i < _options.size(); ++i) {
-      std::shared_ptr<SDL_Surface> surface = FontBook::render(_fontName, _fontSize, _options[i], _textColor);
-      SDL_Texture* texture = SDL_CreateTextureFromSurface(getRenderer().get(), surface.get());
+      std::shared_ptr<SDL_Surface> surface = FontBook::render(_fontName, _fontSize, _options[i], TINT_WHITE);
+      SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), surface.get()));
       
       SDL_FRect dstRect;
       dstRect.x = 0;
@@ -426,7 +462,36 @@ namespace SGI {
       }
       SDL_DestroyTexture(texture);
     }
-    SDL_SetRenderTarget(getRenderer().get(), nullptr);
+    SDL_SetRenderTarget(getRenderer().get(), previousTarget);
+  }
+
+  void FlatSelect::_updateOptionsBounds()
+  {
+    bool atlas = FontBook::isGlyphAtlasEnabled();
+    if ((atlas ? _noOptionsWidth == 0 : _noOptionsTexture == nullptr) && !_noOptionsText.empty()) {
+      _updateNoOptionsLadel();
+    }
+
+    if ((atlas ? _optionsHeight == 0 : _optionsTexture == nullptr) && !_options.empty()) {
+      _updateOptionsLadel();
+    }
+
+    _optionsBounds.x = _bounds.x;
+    _optionsBounds.y = _bounds.y + _bounds.h;
+    _optionsBounds.w = _bounds.w;
+
+    if (_options.size() == 0) {
+      _optionsBounds.h = _noOptionsHeight;
+    } else {
+      int displayItems = (_options.size() < 5 ? _options.size() : 5);
+      _optionsBounds.h = _optionItemHeight * displayItems + ((displayItems - 1) * _optionItemSpace);
+    }
+    _optionsBounds.h += _padding.top + _padding.bottom;
+
+    _optionsContent.x = _optionsBounds.x + _padding.left;
+    _optionsContent.y = _optionsBounds.y + _padding.top;
+    _optionsContent.w = _optionsBounds.w - _padding.left - _padding.right;
+    _optionsContent.h = _optionsBounds.h - _padding.top - _padding.bottom;
   }
 
   void FlatSelect::_updateSelected()
@@ -438,6 +503,13 @@ namespace SGI {
     if (mouseYOffset < 0) {
       mouseYOffset = 0;
     }
-    _mouseOverOptionIndex = mouseYOffset / (_optionItemHeight + _optionItemSpace);
+
+    int index = mouseYOffset / (_optionItemHeight + _optionItemSpace);
+    if (index != _mouseOverOptionIndex) {
+      _mouseOverOptionIndex = index;
+      if (_opened) {
+        _invalidateOverlay();
+      }
+    }
   }
 }
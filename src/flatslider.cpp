@@ -30,21 +30,14 @@ namespace SGI {
 
   }
 
-  std::string FlatSlider::addChangeListener(const Widget::Callback& handler)
+  Uint64 FlatSlider::addChangeListener(const Widget::Callback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_changeHandelers.find(id) != _changeHandelers.end());
-    _changeHandelers[id] = handler;
-
-    return id;
+    return _changeListeners.add(handler);
   }
 
-  void FlatSlider::removeChangeListener(const std::string& id)
+  void FlatSlider::removeChangeListener(Uint64 handle)
   {
-    _changeHandelers.erase(id);
+    _changeListeners.remove(handle);
   }
 
   int FlatSlider::getValue()
@@ -73,15 +66,11 @@ namespace SGI {
       if (_orientation == Orientation::Horizontal) {
         double newValue = _minValue + ((mousePoint.x - getContentArea().x) / (double)getContentArea().w) * (_maxValue - _minValue);
         setValue(newValue);
-        for (const auto& [id, handler] : _changeHandelers) {
-          handler(_root, _self);
-        }
+        _changeListeners.call(_root, _self);
       } else {
         double newValue = _minValue + ((mousePoint.y - getContentArea().y) / (double)getContentArea().h) * (_maxValue - _minValue);
         setValue(newValue);
-        for (const auto& [id, handler] : _changeHandelers) {
-          handler(_root, _self);
-        }
+        _changeListeners.call(_root, _self);
       }
       return true;
     }
@@ -105,20 +94,22 @@ namespace SGI {
   void FlatSlider::setOrientation(Orientation orientation)
   {
     _orientation = orientation;
+    _invalidate();
   }
 
-  void FlatSlider::setTheme(std::string name)
+  void FlatSlider::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _trackBorder = theme.colors.borderColor;
-    _trackFill = theme.colors.fillColor;
-    _handleBorder = theme.colors.accentBorderColor;
-    _handleFill = theme.colors.accentFillColor;
+    Widget::_setTheme(theme);
+    _trackBorder = theme->colors.borderColor;
+    _trackFill = theme->colors.fillColor;
+    _handleBorder = theme->colors.accentBorderColor;
+    _handleFill = theme->colors.accentFillColor;
   }
 
   void FlatSlider::setValue(int value)
   {
     _value = std::clamp(value, _minValue, _maxValue);
+    _invalidate();
   }
   
   void FlatSlider::_render(double deltaTime)
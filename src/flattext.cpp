@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <SDL3/SDL.h>
@@ -8,6 +9,7 @@
 #include "debug.h"
 #include "flattext.h"
 #include "fontbook.h"
+#include "profiler.h"
 
 namespace SGI {
   std::shared_ptr<FlatText> FlatText::create()
@@ -33,14 +35,7 @@ namespace SGI {
 
   FlatText::~FlatText()
   {
-    for (auto& line : _lineTextures) {
-      for (auto& displayTexture : line) {
-        if (displayTexture.texture != nullptr) {
-          SDL_DestroyTexture(displayTexture.texture);
-        }
-      }
-    }
-    _lineTextures.clear();
+    _clearTextures();
   }
 
   std::string FlatText::getFontName()
@@ -70,6 +65,7 @@ namespace SGI {
         if (_totalOffset > _totalHeight - ca.h) {
           _totalOffset = _totalHeight - ca.h;
         }
+        _invalidate();
       }
     }
     return Widget::processEvent(event);
@@ -139,10 +135,10 @@ namespace SGI {
     }
   }
 
-  void FlatText::setTheme(std::string name)
+  void FlatText::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _textColor = theme.colors.textColor;
+    Widget::_setTheme(theme);
+    _textColor = theme->colors.textColor;
     _createTokens(_value, _textColor, {0, 0, 0, 0}, _fontName, _fontSize);
     _updateContent();
   }
@@ -153,46 +149,56 @@ namespace SGI {
       return;
     }
 
-    if (_lineTextures.empty()) {
+    if (_lines.empty() && !_tokens.empty()) {
       _updateContent();
     }
 
     SDL_Rect ca = getContentArea();
-    SDL_SetRenderClipRect(getRenderer().get(), &ca);
-
-    int yOffset = ca.y - _totalOffset;
-    for (const auto& line : _lineTextures) {
-      if (line.size() > 0) {
-        int maxHeight = 0;
-        for (const auto& displayTexture : line) {
-          if (displayTexture.height > maxHeight) {
-            maxHeight = displayTexture.height;
+    _setClipRect(&ca);
+
+    // Find the first line that ends below the top of the viewport
+    auto first = std::upper_bound(_lines.begin(), _lines.end(), _totalOffset, [](int y, const Line& line) {
+      return y < line.y + line.height;
+    });
+
+    size_t firstLine = first - _lines.begin();
+    size_t lastLine = firstLine;
+    while (lastLine < _lines.size() && _lines[lastLine].y < _totalOffset + ca.h) {
+      _renderLine(lastLine, ca.x, ca.y - _totalOffset + _lines[lastLine].y);
+      ++lastLine;
+    }
+    _setClipRect(nullptr);
+
+    // Release the textures of lines that have scrolled out of view
+    bool atlas = FontBook::isGlyphAtlasEnabled();
+    for (auto it = _lineTextures.begin(); it != _lineTextures.end();) {
+      if (atlas || it->first < firstLine || it->first >= lastLine) {
+        for (SDL_Texture* texture : it->second) {
+          if (texture != nullptr) {
+            SDL_DestroyTexture(texture);
           }
         }
-
-        int xOffset = ca.x;
-        for (const auto& displayTexture : line) {
-          int yPos = yOffset + maxHeight - displayTexture.height;
-
-          SDL_FRect posRect;
-          posRect.x = xOffset;
-          posRect.y = yPos;
-          posRect.w = displayTexture.width;
-          posRect.h = displayTexture.height;
-
-          SDL_RenderTexture(getRenderer().get(), displayTexture.texture, nullptr, &posRect);
-          xOffset += displayTexture.width;
-        }
-        yOffset += maxHeight;
+        it = _lineTextures.erase(it);
       } else {
-        yOffset += _fontSize;
+        ++it;
       }
     }
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
 
     Widget::_render(deltaTime);
   }
 
+  void FlatText::_clearTextures()
+  {
+    for (auto& [index, textures] : _lineTextures) {
+      for (SDL_Texture* texture : textures) {
+        if (texture != nullptr) {
+          SDL_DestroyTexture(texture);
+        }
+      }
+    }
+    _lineTextures.clear();
+  }
+
   void FlatText::_createTokens(const std::string& str, SDL_Color defaultTextColor, SDL_Color defaultBgColor, const std::string& defaultFontName, int defaultFontSize)
   {
     _tokens.clear();
@@ -203,8 +209,6 @@ namespace SGI {
     while (pos < str.size()) {
       if (str[pos] == ':' && str[pos + 1] == '[') {
         if (!currentToken.content.empty()) {
-          int height;
-          FontBook::measure(currentToken.fontName, currentToken.fontPoints, currentToken.content, &currentToken.width, &height);
           _tokens.push_back(currentToken);
           currentToken.content.clear();
         }
@@ -307,51 +311,118 @@ namespace SGI {
     }
 
     if (!currentToken.content.empty()) {
-      int height;
-      FontBook::measure(currentToken.fontName, currentToken.fontPoints, currentToken.content, &currentToken.width, &height);
       _tokens.push_back(currentToken);
     }
   }
 
+  void FlatText::_renderLine(size_t index, int x, int y)
+  {
+    const Line& line = _lines[index];
+    bool atlas = FontBook::isGlyphAtlasEnabled();
+
+    std::vector<SDL_Texture*>* textures = nullptr;
+    if (!atlas) {
+      auto it = _lineTextures.find(index);
+      if (it == _lineTextures.end()) {
+        it = _lineTextures.emplace(index, std::vector<SDL_Texture*>()).first;
+        for (size_t i = 0; i < line.pieceCount; ++i) {
+          const Piece& piece = _pieces[line.firstPiece + i];
+          const Token& token = _tokens[piece.token];
+          SDL_Texture* texture = nullptr;
+
+          auto surface = FontBook::render(token.fontName, token.fontPoints, token.content.substr(piece.offset, piece.length), token.textColor, token.bold, token.italic, token.underline, token.strikethrough, token.overline);
+          if (surface) {
+            texture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), surface.get()));
+            if (!texture) {
+              ERROR(FLATTEXT, "Error creating texture: %s", SDL_GetError());
+            }
+          } else {
+            ERROR(FLATTEXT, "Error creating surface: %s", SDL_GetError());
+          }
+          it->second.push_back(texture);
+        }
+      }
+      textures = &it->second;
+    }
+
+    for (size_t i = 0; i < line.pieceCount; ++i) {
+      const Piece& piece = _pieces[line.firstPiece + i];
+
+      SDL_FRect posRect;
+      posRect.x = x;
+      posRect.y = y + line.height - piece.height;
+      posRect.w = piece.width;
+      posRect.h = piece.height;
+
+      if (atlas) {
+        const Token& token = _tokens[piece.token];
+        FontBook::draw(getRenderer().get(), token.fontName, token.fontPoints, token.content.substr(piece.offset, piece.length), token.textColor, posRect.x, posRect.y, token.bold, token.italic, token.underline, token.strikethrough, token.overline);
+      } else if ((*textures)[i] != nullptr) {
+        _renderTexture((*textures)[i], nullptr, posRect);
+      }
+      x += piece.width;
+    }
+  }
+
   void FlatText::_updateContent()
   {
+    _invalidate();
     if (getRenderer() == nullptr) {
       return;
     }
 
-    // Clear existing textures
-    for (auto& line : _lineTextures) {
-      for (auto& displayTexture : line) {
-        if (displayTexture.texture != nullptr) {
-          SDL_DestroyTexture(displayTexture.texture);
-        }
-      }
-    }
-    _lineTextures.clear();
+    _clearTextures();
+    _pieces.clear();
+    _lines.clear();
+    _totalHeight = 0;
 
     _constraints.height.preferredValue = -1;
 
-    // Run through the tokens createing textures
-    // splitting up tokes as need for line wrapping
-    std::vector<DisplayTextures> currentLine;
-    int currentLineMaxHeight = 0;
-    int currentLineWidth = 0;
-    _totalHeight = 0;
+    // Run through the tokens measuring each word and separator,
+    // splitting them into lines as needed for line wrapping.
+    // Textures are only created once a line is scrolled into view.
+    int maxWidth = getContentArea().w;
+    int lineWidth = 0;
+    size_t lineStart = 0;
+
+    auto addLine = [&]() {
+      Line line;
+      line.firstPiece = lineStart;
+      line.pieceCount = _pieces.size() - lineStart;
+      line.y = _totalHeight;
+      line.height = line.pieceCount == 0 ? _fontSize : 0;
+      for (size_t i = lineStart; i < _pieces.size(); ++i) {
+        if (_pieces[i].height > line.height) {
+          line.height = _pieces[i].height;
+        }
+      }
+      _lines.push_back(line);
+      _totalHeight += line.height;
+      lineStart = _pieces.size();
+      lineWidth = 0;
+    };
+
+    auto addPiece = [&](size_t index, size_t offset, size_t length) {
+      const Token& token = _tokens[index];
+      int width = 0, height = 0;
+      FontBook::measure(token.fontName, token.fontPoints, token.content.substr(offset, length), &width, &height, token.bold, token.italic);
+      if (lineWidth + width > maxWidth && _pieces.size() > lineStart) {
+        addLine();
+      }
+      _pieces.push_back({index, offset, length, width, height});
+      lineWidth += width;
+    };
 
-    for (const auto& token : _tokens) {
-        std::string content = token.content;
-        int tokenWidth = 0, tokenHeight = 0;
+    for (size_t index = 0; index < _tokens.size(); ++index) {
+        const char* begin = _tokens[index].content.c_str();
+        const char* ptr = begin;
+        const char* endPtr = ptr + _tokens[index].content.size();
+        size_t chunkStart = 0;
+        size_t chunkLength = 0;
 
-        const char* ptr = content.c_str();
-        const char* endPtr = ptr + content.size();
-        std::string chunk;
-        
         while (ptr < endPtr) {
+            const char* start = ptr;
             Uint32 codepoint = SDL_StepUTF8(&ptr, NULL);
-            char separatorBuff[5];
-            SDL_zero(separatorBuff);
-            SDL_UCS4ToUTF8(codepoint, separatorBuff);
-            std::string utf8Character(separatorBuff);
 
             bool isSeparator = (codepoint == 0x000A || // New Line
                                 codepoint == 0x000C || // Form Feed
@@ -367,119 +438,37 @@ namespace SGI {
                                                codepoint == 0x2029 ||
                                                codepoint == 0x000A);
 
-            if (isSeparator) {
-              if (!chunk.empty()) {
-                // Process the chunk before the separator
-                FontBook::measure(token.fontName, token.fontPoints, chunk, &tokenWidth, &tokenHeight);
-                if (currentLineWidth + tokenWidth > getContentArea().w && !currentLine.empty()) {
-                  _lineTextures.push_back(currentLine);
-                  _totalHeight += currentLineMaxHeight;
-                  currentLineMaxHeight = 0;
-                  currentLine.clear();
-                  currentLineWidth = 0;
-                }
-
-                // LOG(FLATTEXT, "%zu, [%s]", chunk.size(), chunk.c_str());
-                auto surface = FontBook::render(token.fontName, token.fontPoints, chunk, token.textColor, token.bold, token.italic, token.underline, token.strikethrough, token.overline);
-                if (surface) {
-                  SDL_Texture* texture = SDL_CreateTextureFromSurface(getRenderer().get(), surface.get());
-                  if (texture) {
-                    currentLine.push_back({texture, tokenWidth, tokenHeight});
-                    if (tokenHeight > currentLineMaxHeight) {
-                      currentLineMaxHeight = tokenHeight;
-                    }
-                  } else {
-                    ERROR(FLATTEXT, "Error creating texture: %s", SDL_GetError());
-                  }
-                } else {
-                    ERROR(FLATTEXT, "Error creating surface: %s", SDL_GetError());
-                }
-
-                currentLineWidth += tokenWidth;
-                chunk.clear();
+            if (!isSeparator) {
+              if (chunkLength == 0) {
+                chunkStart = start - begin;
               }
-
-              if (isLineOrParagraphSeparator) {
-                _lineTextures.push_back(currentLine);
-                _totalHeight += currentLineMaxHeight;
-                currentLineMaxHeight = 0;
-                currentLine.clear();
-                currentLineWidth = 0;
-              } else {
-                FontBook::measure(token.fontName, token.fontPoints, utf8Character, &tokenWidth, &tokenHeight);
-                if (currentLineWidth + tokenWidth > getContentArea().w && !currentLine.empty()) {
-                  _lineTextures.push_back(currentLine);
-                  if (tokenHeight > currentLineMaxHeight) {
-                    currentLineMaxHeight = tokenHeight;
-                  }
-                  _totalHeight += currentLineMaxHeight;
-                  currentLineMaxHeight = 0;
-                  currentLine.clear();
-                  currentLineWidth = 0;
-                }
-
-                auto surface = FontBook::render(token.fontName, token.fontPoints, utf8Character, token.textColor, token.bold, token.italic, token.underline, token.strikethrough, token.overline);
-                if (surface) {
-                  SDL_Texture* texture = SDL_CreateTextureFromSurface(getRenderer().get(), surface.get());
-                  if (texture) {
-                    currentLine.push_back({texture, tokenWidth, tokenHeight});
-                    if (tokenHeight > currentLineMaxHeight) {
-                      currentLineMaxHeight = tokenHeight;
-                    }
-                  } else {
-                    ERROR(FLATTEXT, "Error creating texture: %s", SDL_GetError());
-                  }
-                } else {
-                  ERROR(FLATTEXT, "Error creating surface: %s", SDL_GetError());
-                }
-                currentLineWidth += tokenWidth;
-              }
-            } else {
-              chunk += utf8Character;
+              chunkLength += ptr - start;
+              continue;
             }
-        }
-
-        // Process any remaining chunk
-        if (!chunk.empty()) {
-          FontBook::measure(token.fontName, token.fontPoints, chunk, &tokenWidth, &tokenHeight);
 
-          if (currentLineWidth + tokenWidth > getContentArea().w && !currentLine.empty()) {
-            _lineTextures.push_back(currentLine);
-            if (tokenHeight > currentLineMaxHeight) {
-              currentLineMaxHeight = tokenHeight;
+            // Process the chunk before the separator
+            if (chunkLength > 0) {
+              addPiece(index, chunkStart, chunkLength);
+              chunkLength = 0;
             }
-            _totalHeight += currentLineMaxHeight;
-            currentLineMaxHeight = 0;
-            currentLine.clear();
-            currentLineWidth = 0;
-          }
 
-          if (tokenHeight > currentLineMaxHeight) {
-            currentLineMaxHeight = tokenHeight;
-          }
-
-          // LOG(FLATTEXT, "%zu, [%s]", chunk.size(), chunk.c_str());
-          auto surface = FontBook::render(token.fontName, token.fontPoints, chunk, token.textColor, token.bold, token.italic, token.underline, token.strikethrough, token.overline);
-          if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(getRenderer().get(), surface.get());
-            if (texture) {
-              currentLine.push_back({texture, tokenWidth, tokenHeight});
+            if (isLineOrParagraphSeparator) {
+              addLine();
             } else {
-              ERROR(FLATTEXT, "Error creating texture: %s", SDL_GetError());
+              addPiece(index, start - begin, ptr - start);
             }
-          } else {
-            ERROR(FLATTEXT, "Error creating surface: %s", SDL_GetError());
-          }
+        }
 
-          currentLineWidth += tokenWidth;
-      }
+        // Process any remaining chunk
+        if (chunkLength > 0) {
+          addPiece(index, chunkStart, chunkLength);
+        }
     }
 
-    if (!currentLine.empty()) {
-      _lineTextures.push_back(currentLine);
-      _totalHeight += currentLineMaxHeight;
-      LOG(FLATEXT, "Current Line Height: %d %d", currentLineMaxHeight, _totalHeight);
+    if (_pieces.size() > lineStart) {
+      addLine();
     }
+    LOG(FLATTEXT, "Laid out %zu lines, %d high", _lines.size(), _totalHeight);
 
     _constraints.height.preferredValue = _totalHeight + _padding.top + _padding.bottom;
   }
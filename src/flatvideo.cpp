@@ -3,6 +3,7 @@
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include "debug.h"
+#include "drawlist.h"
 #include "flatvideo.h"
 #include "platform.h"
 
@@ -37,16 +38,20 @@ namespace SGI {
         _callback(_root, _self, currentTime, maxTime);
       });
     }
+    _setAnimating(true);
   }
 
   void FlatVideo::play()
   {
     _video->play();
+    _setAnimating(true);
   }
 
   void FlatVideo::stop()
   {
     _video->stop();
+    _setAnimating(false);
+    _invalidate();
   }
 
   void FlatVideo::seek(int time)
@@ -79,11 +84,11 @@ namespace SGI {
     }
   }
 
-  void FlatVideo::setTheme(std::string name)
+  void FlatVideo::_setTheme(const Theme* theme)
   {
-    Flat::Theme theme = _getTheme(name);
-    _borderColor = theme.colors.borderColor;
-    _fillColor = theme.colors.backgroundColor;
+    Widget::_setTheme(theme);
+    _borderColor = theme->colors.borderColor;
+    _fillColor = theme->colors.backgroundColor;
   }
 
   void FlatVideo::_cleanup()
@@ -98,13 +103,19 @@ namespace SGI {
   
   void FlatVideo::_render(double deltaTime)
   {
-    SDL_SetRenderClipRect(getRenderer().get(), &_bounds);
+    _setClipRect(&_bounds);
     _drawRoundedRect(getRenderer().get(), _bounds, _borderColor, _fillColor, true, 1, 6);
 
+    // The video draws straight to SDL, so the background and clip have to be issued first
+    DrawList* drawList = DrawList::get(getRenderer().get());
+    if (drawList) {
+      drawList->flush();
+    }
+
     SDL_Rect ca = getContentArea();
     _video->render(getRenderer().get(), ca);
 
-    SDL_SetRenderClipRect(getRenderer().get(), nullptr);
+    _setClipRect(nullptr);
   }
 
 }
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include <iostream>
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include "bundle.h"
 #include "debug.h"
 #include "defaultfont.h"
+#include "drawlist.h"
 #include "fontbook.h"
+#include "profiler.h"
 
 namespace SGI {
   FontBook* FontBook::_instance = nullptr;
@@ -55,57 +58,295 @@ namespace SGI {
   {
     initialize();
 
-    _instance->_fontFiles[id] = _instance->_fontpath + fontFile;
+    _instance->_fontFiles[id] = fontFile;
   }
 
   void FontBook::addFontSize(const std::string id, int ptSize)
   {
     initialize();
 
-    std::string key = id + "-" + std::to_string(ptSize);
     TTF_Font* font;
 
     if (id == "default") {
       SDL_IOStream* data = SDL_IOFromMem(defaultFont, 874988);
       font = TTF_OpenFontIO(data, true, ptSize);
     } else {
-      font = TTF_OpenFont(_instance->_fontFiles[id].c_str(), ptSize);
+      font = TTF_OpenFontIO(Bundle::openResource(_instance->_fontpath, _instance->_fontFiles[id]), true, ptSize);
     }
 
     if (font) {
+      _instance->_addFont({id, ptSize}, font, nullptr);
+    } else {
+      ERROR(FONTBOOK, "Error opening font: %s", SDL_GetError());
+    }
+  }
+
+  AssetPtr FontBook::addFontSizeAsync(const std::string id, int ptSize, const AssetLoader::Callback& callback)
+  {
+    initialize();
+
+    FontKey key = {id, ptSize};
+    std::string fontPath = _instance->_fontpath;
+    std::string fontFile = _instance->_fontFiles[id];
+    auto data = std::make_shared<std::shared_ptr<void>>();
+    auto size = std::make_shared<size_t>(0);
+
+    return AssetLoader::load([id, fontPath, fontFile, data, size]() {
+      if (id == "default") {
+        return true;
+      }
+
+      // Bundled fonts are already in memory and stay there
+      const void* bundled = Bundle::getResource(fontFile, size.get());
+      if (bundled) {
+        *data = std::shared_ptr<void>(const_cast<void*>(bundled), [](void*) {});
+        return true;
+      }
+
+      void* file = SDL_LoadFile((fontPath + fontFile).c_str(), size.get());
+      if (!file) {
+        return false;
+      }
+      *data = std::shared_ptr<void>(file, SDL_free);
+      return true;
+    }, [key, data, size]() {
+      // Drawing text with the font before it was ready loaded it already
       if (_instance->_fonts.find(key) != _instance->_fonts.end()) {
-        TTF_CloseFont(_instance->_fonts[key]);
-        _instance->_fonts.erase(key);
+        return true;
       }
-      _instance->_fonts[key] = font;
-      if (id == "default") {
-        LOG(FONTBOOK, "Added font %s", key.c_str());
+      if (!*data) {
+        addFontSize(key.first, key.second);
+        return _instance->_fonts.find(key) != _instance->_fonts.end();
+      }
+
+      TTF_Font* font = TTF_OpenFontIO(SDL_IOFromConstMem(data->get(), *size), true, key.second);
+      if (!font) {
+        ERROR(FONTBOOK, "Error opening font: %s", SDL_GetError());
+        return false;
+      }
+      _instance->_addFont(key, font, *data);
+      return true;
+    }, [key, fontFile, callback](bool success) {
+      if (!success) {
+        ERROR(FONTBOOK, "Unable to load font %s-%d from %s", key.first.c_str(), key.second, fontFile.c_str());
+      }
+      if (callback) {
+        callback(success);
+      }
+    });
+  }
+
+  bool FontBook::draw(SDL_Renderer* renderer, const std::string name, int ptSize, const std::string text, const SDL_Color &fg, float x, float y, bool bold, bool italic, bool underline, bool strikethrough, bool overline)
+  {
+    initialize();
+
+    if (renderer == nullptr || text.empty()) {
+      return false;
+    }
+
+    TTF_Font* font = _instance->_getFont(name, ptSize);
+    if (font == nullptr) {
+      return false;
+    }
+
+    int style = TTF_STYLE_NORMAL;
+    if (bold) {
+      style += TTF_STYLE_BOLD;
+    }
+    if (italic) {
+      style += TTF_STYLE_ITALIC;
+    }
+
+    GlyphAtlas& atlas = _instance->_atlases[renderer];
+    DrawList* drawList = DrawList::get(renderer);
+    SDL_FColor color = {fg.r / 255.0f, fg.g / 255.0f, fg.b / 255.0f, fg.a / 255.0f};
+    bool kerning = TTF_GetFontKerning(font) != 0;
+
+    float penX = x;
+    Uint32 previous = 0;
+    const char* ptr = text.c_str();
+    const char* endPtr = ptr + text.size();
+    while (ptr < endPtr) {
+      Uint32 codepoint = SDL_StepUTF8(&ptr, NULL);
+      if (kerning && previous != 0) {
+        penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+      }
+      previous = codepoint;
+
+      const Glyph* glyph = _instance->_getGlyph(renderer, atlas, font, style, codepoint);
+      if (glyph == nullptr) {
+        continue;
+      }
+
+      if (glyph->page >= 0) {
+        std::vector<SDL_Vertex>& vertices = atlas.pages[glyph->page].vertices;
+        float left = penX + glyph->offsetX;
+        float top = y;
+        float right = left + glyph->source.w;
+        float bottom = top + glyph->source.h;
+        float u1 = glyph->source.x / ATLAS_PAGE_SIZE;
+        float v1 = glyph->source.y / ATLAS_PAGE_SIZE;
+        float u2 = (glyph->source.x + glyph->source.w) / ATLAS_PAGE_SIZE;
+        float v2 = (glyph->source.y + glyph->source.h) / ATLAS_PAGE_SIZE;
+
+        vertices.push_back({{left, top}, color, {u1, v1}});
+        vertices.push_back({{right, top}, color, {u2, v1}});
+        vertices.push_back({{right, bottom}, color, {u2, v2}});
+        vertices.push_back({{left, bottom}, color, {u1, v2}});
+      }
+      penX += glyph->advance;
+    }
+
+    // One draw call per atlas page used by the text
+    for (auto& page : atlas.pages) {
+      if (page.vertices.empty()) {
+        continue;
+      }
+
+      size_t quads = page.vertices.size() / 4;
+      while (_instance->_indices.size() < quads * 6) {
+        int base = (_instance->_indices.size() / 6) * 4;
+        _instance->_indices.insert(_instance->_indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+      }
+
+      if (drawList) {
+        drawList->geometry(page.texture.get(), page.vertices.data(), page.vertices.size(), _instance->_indices.data(), quads * 6);
       } else {
-        LOG(FONTBOOK, "Added font %s from %s", key.c_str(), _instance->_fontFiles[id].c_str());
+        SDL_RenderGeometry(renderer, page.texture.get(), page.vertices.data(), page.vertices.size(), _instance->_indices.data(), quads * 6);
       }
-    } else {
-      ERROR(FONTBOOK, "Error opening font: %s", SDL_GetError());
+      page.vertices.clear();
     }
+
+    if (underline || strikethrough || overline) {
+      int ascent = TTF_FontAscent(font);
+      int height = TTF_FontHeight(font);
+      float thickness = height > 30 ? 2 : 1;
+
+      std::vector<SDL_FRect> lines;
+      if (underline) {
+        lines.push_back({x, y + ascent + thickness, penX - x, thickness});
+      }
+      if (strikethrough) {
+        lines.push_back({x, y + height / 2.0f, penX - x, thickness});
+      }
+      if (overline) {
+        lines.push_back({x, y + height - ascent - 1, penX - x, thickness});
+      }
+
+      for (const SDL_FRect& line : lines) {
+        if (drawList) {
+          drawList->fillRect(line, fg);
+        } else {
+          SDL_SetRenderDrawColor(renderer, fg.r, fg.g, fg.b, fg.a);
+          SDL_RenderFillRect(renderer, &line);
+        }
+      }
+    }
+
+    return true;
   }
 
-  bool FontBook::measure(const std::string name, int ptSize, const std::string text, int *width, int *heigt)
+  bool FontBook::isGlyphAtlasEnabled()
   {
     initialize();
 
-    std::string key = name + "-" + std::to_string(ptSize);
+    return _instance->_glyphAtlasEnabled;
+  }
 
-    auto it = _instance->_fonts.find(key);
-    if (it == _instance->_fonts.end()) {
-      addFontSize(name, ptSize);
-      it = _instance->_fonts.find(key);
+  FontBook::MeasureStats FontBook::getMeasureStats()
+  {
+    initialize();
+
+    MeasureStats stats = _instance->_measureStats;
+    stats.entries = _instance->_measures.size();
+    stats.capacity = _instance->_measureCapacity;
+    return stats;
+  }
+
+  bool FontBook::measure(const std::string& name, int ptSize, const std::string& text, int *width, int *heigt, bool bold, bool italic)
+  {
+    initialize();
+
+    TTF_Font* font = _instance->_getFont(name, ptSize);
+    if (font == nullptr) {
+      return false;
+    }
+
+    int style = TTF_STYLE_NORMAL;
+    if (bold) {
+      style += TTF_STYLE_BOLD;
+    }
+    if (italic) {
+      style += TTF_STYLE_ITALIC;
+    }
+
+    // Single Latin-1 characters come from the glyph tables
+    const char* ptr = text.c_str();
+    const char* endPtr = ptr + text.size();
+    Uint32 codepoint = text.empty() ? 0 : SDL_StepUTF8(&ptr, NULL);
+    if (ptr == endPtr && codepoint > 0 && codepoint < GLYPH_TABLE_SIZE) {
+      std::vector<GlyphSize>& table = _instance->_glyphSizes[std::make_pair(font, style)];
+      if (table.empty()) {
+        table.resize(GLYPH_TABLE_SIZE);
+      }
+
+      GlyphSize& size = table[codepoint];
+      if (size.width < 0) {
+        _instance->_measureStats.misses++;
+        TTF_SetFontStyle(font, style);
+        if (TTF_SizeUTF8(font, text.c_str(), &size.width, &size.height) < 0) {
+          size.width = -1;
+          ERROR(FONTBOOK, "Error measures text: %s", SDL_GetError());
+          return false;
+        }
+      } else {
+        _instance->_measureStats.glyphHits++;
+      }
+
+      *width = size.width;
+      *heigt = size.height;
+      return true;
+    }
+
+    MeasureKey key = {font, style, std::hash<std::string>()(text)};
+    auto it = _instance->_measures.find(key);
+    if (it != _instance->_measures.end() && it->second.text == text) {
+      _instance->_measureStats.hits++;
+      _instance->_measureOrder.splice(_instance->_measureOrder.begin(), _instance->_measureOrder, it->second.order);
+      *width = it->second.width;
+      *heigt = it->second.height;
+      return true;
     }
+    _instance->_measureStats.misses++;
 
-    int status = TTF_SizeUTF8(_instance->_fonts[key], text.c_str(), width, heigt);
+    TTF_SetFontStyle(font, style);
+    int status = TTF_SizeUTF8(font, text.c_str(), width, heigt);
     if (status == -1) {
       ERROR(FONTBOOK, "Error measures text: %s", SDL_GetError());
       return false;
     }
 
+    if (_instance->_measureCapacity == 0) {
+      return true;
+    }
+
+    if (it != _instance->_measures.end()) {
+      // Hash collision, the newer text takes over the entry
+      it->second.text = text;
+      it->second.width = *width;
+      it->second.height = *heigt;
+      _instance->_measureOrder.splice(_instance->_measureOrder.begin(), _instance->_measureOrder, it->second.order);
+      return true;
+    }
+
+    while (_instance->_measures.size() >= _instance->_measureCapacity) {
+      _instance->_measures.erase(_instance->_measureOrder.back());
+      _instance->_measureOrder.pop_back();
+    }
+
+    _instance->_measureOrder.push_front(key);
+    _instance->_measures[key] = {text, *width, *heigt, _instance->_measureOrder.begin()};
+
     return true;
   }
 
@@ -113,12 +354,9 @@ namespace SGI {
   {
     initialize();
 
-    std::string key = name + "-" + std::to_string(ptSize);
-
-    auto it = _instance->_fonts.find(key);
-    if (it == _instance->_fonts.end()) {
-      addFontSize(name, ptSize);
-      it = _instance->_fonts.find(key);
+    TTF_Font* font = _instance->_getFont(name, ptSize);
+    if (font == nullptr) {
+      return nullptr;
     }
 
     int style = TTF_STYLE_NORMAL;
@@ -135,14 +373,14 @@ namespace SGI {
       style += TTF_STYLE_STRIKETHROUGH;
     }
 
-    TTF_SetFontStyle(_instance->_fonts[key], style);
-    SDL_Surface *surface = TTF_RenderUTF8_Blended(_instance->_fonts[key], text.c_str(), fg);
+    TTF_SetFontStyle(font, style);
+    SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text.c_str(), fg);
     if (surface == nullptr) {
       return nullptr;
     }
 
     if (overline) {
-      int ascent = TTF_FontAscent(_instance->_fonts[key]);
+      int ascent = TTF_FontAscent(font);
       int overlineY = surface->h - ascent - 1;
 
       if (SDL_MUSTLOCK(surface)) {
@@ -165,4 +403,198 @@ namespace SGI {
     return output;
   }
 
+  void FontBook::releaseRenderer(SDL_Renderer* renderer)
+  {
+    if (_instance == nullptr) {
+      return;
+    }
+
+    _instance->_atlases.erase(renderer);
+  }
+
+  void FontBook::resetMeasureStats()
+  {
+    initialize();
+
+    _instance->_measureStats = MeasureStats();
+  }
+
+  void FontBook::setGlyphAtlasEnabled(bool value)
+  {
+    initialize();
+
+    _instance->_glyphAtlasEnabled = value;
+  }
+
+  void FontBook::setMeasureCacheSize(size_t entries)
+  {
+    initialize();
+
+    _instance->_measureCapacity = entries;
+    while (_instance->_measures.size() > _instance->_measureCapacity) {
+      _instance->_measures.erase(_instance->_measureOrder.back());
+      _instance->_measureOrder.pop_back();
+    }
+  }
+
+  bool FontBook::_addGlyphPage(SDL_Renderer* renderer, GlyphAtlas& atlas)
+  {
+    SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE));
+    if (!texture) {
+      ERROR(FONTBOOK, "Glyph atlas page not created: %s", SDL_GetError());
+      return false;
+    }
+
+    std::vector<Uint32> clear(ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, clear.data(), ATLAS_PAGE_SIZE * sizeof(Uint32));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    GlyphPage page;
+    page.texture = std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
+      if (p) {
+        LOG(MEMORY, "SDL_Texture has been freed");
+        SDL_DestroyTexture(p);
+      }
+    });
+    atlas.pages.push_back(page);
+    LOG(FONTBOOK, "Added glyph atlas page %zu", atlas.pages.size());
+
+    return true;
+  }
+
+  const FontBook::Glyph* FontBook::_getGlyph(SDL_Renderer* renderer, GlyphAtlas& atlas, TTF_Font* font, int style, Uint32 codepoint)
+  {
+    GlyphKey key = {font, style, codepoint};
+    auto it = atlas.glyphs.find(key);
+    if (it != atlas.glyphs.end()) {
+      return &it->second;
+    }
+
+    Glyph glyph;
+    int minX, maxX, minY, maxY, advance;
+    TTF_SetFontStyle(font, style);
+    if (TTF_GlyphMetrics32(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) < 0) {
+      return nullptr;
+    }
+    glyph.advance = advance;
+    glyph.offsetX = minX < 0 ? minX : 0;
+
+    // Glyphs are rasterized in white so they can be tinted per vertex
+    SDL_Surface* surface = TTF_RenderGlyph32_Blended(font, codepoint, SDL_Color{255, 255, 255, 255});
+    if (surface && surface->format != SDL_PIXELFORMAT_ARGB8888) {
+      SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+      SDL_DestroySurface(surface);
+      surface = converted;
+    }
+
+    if (surface && surface->w > 0 && surface->h > 0 && surface->w + 2 <= ATLAS_PAGE_SIZE && surface->h + 2 <= ATLAS_PAGE_SIZE) {
+      if (atlas.pages.empty() && !_addGlyphPage(renderer, atlas)) {
+        SDL_DestroySurface(surface);
+        return nullptr;
+      }
+
+      // Shelf packing with a one pixel gutter between glyphs
+      GlyphPage* page = &atlas.pages.back();
+      if (page->shelfX + surface->w + 1 > ATLAS_PAGE_SIZE) {
+        page->shelfX = 1;
+        page->shelfY += page->shelfHeight + 1;
+        page->shelfHeight = 0;
+      }
+      if (page->shelfY + surface->h + 1 > ATLAS_PAGE_SIZE) {
+        if (!_addGlyphPage(renderer, atlas)) {
+          SDL_DestroySurface(surface);
+          return nullptr;
+        }
+        page = &atlas.pages.back();
+      }
+
+      SDL_Rect rect = {page->shelfX, page->shelfY, surface->w, surface->h};
+      SDL_UpdateTexture(page->texture.get(), &rect, surface->pixels, surface->pitch);
+
+      page->shelfX += surface->w + 1;
+      if (surface->h > page->shelfHeight) {
+        page->shelfHeight = surface->h;
+      }
+
+      glyph.page = atlas.pages.size() - 1;
+      glyph.source = {(float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h};
+    }
+
+    if (surface) {
+      SDL_DestroySurface(surface);
+    }
+
+    auto inserted = atlas.glyphs.emplace(key, glyph);
+    return &inserted.first->second;
+  }
+
+  void FontBook::_addFont(const FontKey& key, TTF_Font* font, const std::shared_ptr<void>& data)
+  {
+    if (_fonts.find(key) != _fonts.end()) {
+      // Drop any glyphs rasterized from the font being replaced
+      for (auto& [renderer, atlas] : _atlases) {
+        for (auto it = atlas.glyphs.begin(); it != atlas.glyphs.end();) {
+          if (it->first.font == _fonts[key]) {
+            it = atlas.glyphs.erase(it);
+          } else {
+            ++it;
+          }
+        }
+      }
+      _purgeMeasures(_fonts[key]);
+      TTF_CloseFont(_fonts[key]);
+      _fonts.erase(key);
+    }
+    _fonts[key] = font;
+
+    // SDL_ttf reads the font as it is used, so the memory must outlive it
+    if (data) {
+      _fontData[key] = data;
+    } else {
+      _fontData.erase(key);
+    }
+
+    if (key.first == "default") {
+      LOG(FONTBOOK, "Added font %s-%d", key.first.c_str(), key.second);
+    } else {
+      LOG(FONTBOOK, "Added font %s-%d from %s", key.first.c_str(), key.second, _fontFiles[key.first].c_str());
+    }
+  }
+
+  TTF_Font* FontBook::_getFont(const std::string& name, int ptSize)
+  {
+    FontKey key = {name, ptSize};
+
+    auto it = _fonts.find(key);
+    if (it == _fonts.end()) {
+      addFontSize(name, ptSize);
+      it = _fonts.find(key);
+      if (it == _fonts.end()) {
+        return nullptr;
+      }
+    }
+
+    return it->second;
+  }
+
+  void FontBook::_purgeMeasures(TTF_Font* font)
+  {
+    for (auto it = _measureOrder.begin(); it != _measureOrder.end();) {
+      if (it->font == font) {
+        _measures.erase(*it);
+        it = _measureOrder.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    for (auto it = _glyphSizes.begin(); it != _glyphSizes.end();) {
+      if (it->first.first == font) {
+        it = _glyphSizes.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
 }
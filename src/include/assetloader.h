@@ -0,0 +1,133 @@
+#ifndef SGI_ASSETLOADER_H
+#define SGI_ASSETLOADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <SDL3/SDL.h>
+#include <thread>
+#include <vector>
+
+namespace SGI {
+  /**
+   * Loads assets without blocking the main thread
+   *
+   * Each asset is loaded in two steps. Decoding, like reading a file
+   * and decompressing it, runs on a pool of worker threads. Uploading,
+   * like creating a texture, must happen on the main thread, so it is
+   * queued until update is called. update only runs uploads for a
+   * limited time so loading many assets doesn't stall a frame.
+   *
+   * Window::run calls update every frame. Applications with their own
+   * loop must call it themselves.
+   */
+  class AssetLoader {
+  public:
+    enum class State {
+      Pending,
+      Ready,
+      Failed,
+    };
+
+    /**
+     * The progress of an asset being loaded
+     */
+    class Asset {
+    public:
+      State getState() { return _state; }
+      bool isReady() { return _state == State::Ready; }
+
+    private:
+      friend class AssetLoader;
+
+      std::atomic<State> _state { State::Pending };
+    };
+
+    using AssetPtr = std::shared_ptr<Asset>;
+
+    /**
+     * Called on the main thread once an asset is ready or has failed
+     *
+     * \param success true if the asset is ready
+     */
+    using Callback = std::function<void(bool success)>;
+
+    void operator=(const AssetLoader &) = delete;
+
+    /**
+     * Returns the number of assets that are not ready or failed yet
+     */
+    static size_t getPendingCount();
+
+    /**
+     * Loads an asset
+     *
+     * \param decode runs on a worker thread, returns false on failure
+     * \param upload runs on the main thread after decode succeeds,
+     *               returns false on failure
+     * \param callback called on the main thread when done, may be nullptr
+     * \returns the asset's progress
+     */
+    static AssetPtr load(const std::function<bool()>& decode, const std::function<bool()>& upload, const Callback& callback);
+
+    /**
+     * Stops the worker threads
+     *
+     * Decodes that are running are finished, the ones still queued are
+     * dropped. Called automatically at exit, so the workers don't run
+     * against statics that are being destroyed.
+     */
+    static void shutdown();
+
+    /**
+     * Uploads decoded assets and calls their callbacks
+     *
+     * Must be called on the main thread. At least one upload runs
+     * when any are waiting, even if it takes longer than budget.
+     *
+     * \param budget the milliseconds to spend uploading
+     * \returns the number of assets that finished
+     */
+    static int update(double budget);
+
+  private:
+    AssetLoader();
+    ~AssetLoader();
+
+    static void initialize();
+
+    static AssetLoader* _instance;
+
+    struct Job {
+      AssetPtr asset;
+      std::function<bool()> decode;
+      std::function<bool()> upload;
+      Callback callback;
+      bool decoded;
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<Job> _decodeQueue;
+    std::deque<Job> _uploadQueue;
+    std::atomic<size_t> _pending { 0 };
+    std::vector<std::thread> _workers;
+    bool _stopping = false;
+
+    /**
+     * An event pushed when an upload is queued
+     *
+     * Wakes the main thread when it is waiting for events.
+     */
+    Uint32 _eventType = 0;
+
+    void _work();
+  };
+
+  using AssetPtr = AssetLoader::AssetPtr;
+}
+
+#endif // SGI_ASSETLOADER_H
@@ -1,19 +1,88 @@
 #ifndef SGI_AUDIOPLAYER_H
 #define SGI_AUDIOPLAYER_H
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <SDL3/SDL.h>
 #include <string>
+#include <thread>
+#include <vector>
+#include "assetloader.h"
+#include "spscqueue.h"
 #include "widget.h"
 
 namespace SGI {
+  class AudioDecoder;
+
+  /**
+   * Plays sounds
+   *
+   * The audio thread owns a fixed table of voices and a preallocated
+   * mix buffer. Everything else, like play or unload, is sent to it
+   * through a lock free queue, so the audio thread never locks or
+   * allocates. Sample data is never changed once it is published;
+   * replaced or unloaded samples are only freed after the audio thread
+   * is done with them.
+   *
+   * A sound can play many times at once. Each play takes a voice that
+   * refers to the sound's shared sample and returns a handle to it, so
+   * one instance can be changed or stopped on its own.
+   *
+   * AudioPlayer must only be used from one thread, usually the main
+   * thread.
+   */
   class AudioPlayer {
   public:
+    /**
+     * One playing instance of a sound, 0 is no instance
+     */
+    using VoiceHandle = Uint64;
+
+    /**
+     * What play does when there is no voice for another instance
+     */
+    enum class Steal {
+      Oldest,     // takes the voice of the instance that started first
+      None,       // doesn't play
+    };
+
     void operator=(const AudioPlayer &) = delete;
 
+    /**
+     * Returns the bytes of unloaded or replaced sounds not freed yet
+     *
+     * They are freed by update once the audio thread is done with them.
+     */
+    static size_t getRetiredBytes();
+
     static bool isPlaying(const std::string& id);
+    static bool isPlaying(VoiceHandle voice);
     static bool load(const std::string& id, const std::string& filename);
 
+    /**
+     * Loads a sound without blocking
+     * 
+     * The file is decoded and converted to the device format by the
+     * AssetLoader, the sound can be played once it is ready.
+     * 
+     * \param callback called on the main thread when the sound is added
+     * \returns the sound's progress
+     */
+    static AssetPtr loadAsync(const std::string& id, const std::string& filename, const AssetLoader::Callback& callback = nullptr);
+
+    /**
+     * Loads a sound that is decoded as it plays
+     * 
+     * Meant for long sounds like music. Instead of decoding the whole
+     * file up front, a decoder thread keeps a small buffer ahead of the
+     * playing position, so memory use doesn't depend on the length of
+     * the sound. WAV files are not compressed and are loaded normally.
+     */
+    static bool loadStream(const std::string& id, const std::string& filename);
+
     static void newBuffer(const std::string& id);
     static bool bufferAddTone(const std::string& id, int freq, int duration, int cycles, int delay);
 
@@ -26,15 +95,87 @@ namespace SGI {
      */
     static bool bufferAddMusic(const std::string& id, const std::string& music);
 
+    /**
+     * Mixes the playing sounds into a buffer
+     * 
+     * This is what the audio device is fed with. Each playing sound
+     * advances by length bytes, so it can also be used to render
+     * audio offline or to benchmark the mixer. The whole buffer is
+     * soft clipped once everything is mixed.
+     * 
+     * \param buffer interleaved stereo 32-bit float samples to mix into
+     * \param length the size of buffer in bytes
+     */
+    static void mix(Uint8* buffer, int length);
+
     static void pause(const std::string& id);
-    static void play(const std::string& id, bool repeating = false);
+    static void pause(VoiceHandle voice);
+
+    /**
+     * Plays a sound
+     * 
+     * Every call starts another instance unless the sound is paused, in
+     * which case it is resumed. A streamed sound only has one instance,
+     * so playing it again starts it over.
+     * 
+     * \returns the instance, or 0 if the sound could not be played
+     */
+    static VoiceHandle play(const std::string& id, bool repeating = false);
+
+    static void resume(VoiceHandle voice);
+
+    /**
+     * Moves a sound to a time
+     * 
+     * \param seconds from the start of the sound
+     */
+    static void seek(const std::string& id, double seconds);
+
     static void stop(const std::string& id);
+    static void stop(VoiceHandle voice);
+
+    /**
+     * Sets the volume of a sound
+     *
+     * Changes the playing instances and the ones played later.
+     *
+     * \param gain the volume, 1.0 is unchanged
+     */
+    static void setGain(const std::string& id, float gain);
+    static void setGain(VoiceHandle voice, float gain);
+
+    /**
+     * Limits how many instances of a sound play at once
+     *
+     * The steal policy is also used when every voice is in use.
+     *
+     * \param count the most instances, 0 for no limit
+     * \param steal what to do when another instance is played
+     */
+    static void setMaxInstances(const std::string& id, int count, Steal steal = Steal::Oldest);
+
+    /**
+     * Sets the balance of a sound
+     *
+     * Changes the playing instances and the ones played later.
+     *
+     * \param pan -1.0 is left only, 0.0 is centered and 1.0 is right only
+     */
+    static void setPan(const std::string& id, float pan);
+    static void setPan(VoiceHandle voice, float pan);
 
     static void setRepeating(const std::string& id, bool value);
     static void setResourcePath(const std::string path);
 
     static void unload(const std::string& id);
 
+    /**
+     * Frees the unloaded or replaced sounds the audio thread is done with
+     *
+     * Window::run calls this every frame.
+     */
+    static void update();
+
   private:
     AudioPlayer();
     ~AudioPlayer();
@@ -43,29 +184,227 @@ namespace SGI {
 
     static AudioPlayer* _instance;
 
-    struct AudioData {
-      Uint8* pos;
-      Uint8* start;
-      Uint32 length;
-      Uint32 totalLength;
-      bool playing;
+    static const int CHANNELS = 2;
+    static const int FRAME_SIZE = CHANNELS * sizeof(float);
+    static const int MAX_VOICES = 256;
+    static const int MIX_BUFFER_SIZE = 16384;
+    static const int COMMAND_QUEUE_SIZE = 1024;
+    static const size_t STREAM_BUFFER_SIZE = 1 << 18;
+
+    /**
+     * A ring buffer the decoder thread keeps ahead of a playing stream
+     * 
+     * The decoder thread writes and the audio thread reads. Positions
+     * only grow and are wrapped when the ring is indexed. A seek is
+     * asked for by bumping requested; once the decoder thread has
+     * moved, everything written before discard is from the old
+     * position and applied is set to requested.
+     */
+    struct Stream {
+      // Decoder thread
+      std::unique_ptr<AudioDecoder> decoder;
+      SDL_AudioStream* converter = nullptr;
+      bool ended = false;
+
+      std::unique_ptr<Uint8[]> ring;
+      std::atomic<size_t> read { 0 };
+      std::atomic<size_t> write { 0 };
+      std::atomic<size_t> discard { 0 };
+      std::atomic<size_t> end { SIZE_MAX };   // set once the end of the file is written
+      std::atomic<Uint64> seekFrame { 0 };
+      std::atomic<Uint32> requested { 0 };
+      std::atomic<Uint32> applied { 0 };
+      std::atomic<bool> repeating { false };
+
+      Stream();
+      Stream(const Stream&) = delete;
+      ~Stream();
+    };
+
+    /**
+     * Decoded audio in the device format, never changed once published
+     */
+    struct Sample {
+      Uint8* data = nullptr;
+      Uint32 length = 0;
+      std::unique_ptr<Stream> stream;     // instead of data for streamed sounds
+
+      Sample() { };
+      Sample(const Sample&) = delete;
+      ~Sample() { SDL_free(data); }
+    };
+
+    /**
+     * A loaded sound, only used by the main thread
+     */
+    struct Clip {
+      std::unique_ptr<Sample> sample;
+      float gain = 1.0f;
+      float pan = 0.0f;
+      int maxInstances = 0;
+      Steal steal = Steal::Oldest;
+    };
+
+    /**
+     * What the main thread knows about a voice
+     */
+    struct Instance {
+      Clip* clip = nullptr;
+      Uint32 sequence = 0;        // of the play, 0 if stopped
+      Uint64 started = 0;         // to find the oldest
+      bool paused = false;
+      bool repeating = false;
+    };
+
+    /**
+     * A playing sound, only used by the audio thread
+     */
+    struct Voice {
+      const Sample* sample = nullptr;
+      Uint32 position = 0;
+      Uint32 sequence = 0;
+      Uint32 serial = 0;                  // of the stream seek to play from
+      float gain = 1.0f;
+      float pan = 0.0f;
+
+      // The channel gains being used, ramped toward gain and pan each block
+      float left = 1.0f;
+      float right = 1.0f;
+      float leftStep = 0.0f;
+      float rightStep = 0.0f;
+      bool playing = false;
+      bool repeating = false;
+
+      // Written by the audio thread when a play ends or is stopped
+      std::atomic<Uint32> finished { 0 };
+    };
+
+    struct Command {
+      enum Type {
+        Play,
+        Resume,
+        Pause,
+        Stop,
+        SetGain,
+        SetPan,
+        SetRepeating,
+        SetSample,
+        Seek,
+      };
+
+      Type type;
+      int voice;
+      const Sample* sample;
+      Uint32 sequence;
+      float gain;
       bool repeating;
+      Uint32 serial;
+      Uint32 position;
+      float pan;
     };
 
     static float _getNoteFrequency(char note, int octave, bool sharp, bool flat);
     static float _calculateFrequencyFromNoteNumber(int noteNumber);
 
+    /**
+     * Decodes a WAV, OGG or MP3 file into the device format
+     * 
+     * The file is read from the mounted bundles or from path. Only
+     * reads the obtained spec, so it is safe to call from any thread.
+     */
+    static bool _decode(const std::string& path, const std::string& filename, Sample& sample);
 
     static void _audioCallback(void *userdata, SDL_AudioStream *astream, int additional_amount, int total_amount);
 
+    /**
+     * Applies queued commands and mixes the voices, called by the audio thread
+     */
+    void _mix(Uint8* buffer, int length);
+    void _mixSample(Voice& voice, Uint8* buffer, int length);
+    void _mixStream(Voice& voice, Stream& stream, Uint8* buffer, int length);
+
+    /**
+     * Mixes part of a voice's block, moving its gains along their ramp
+     */
+    void _mixVoice(Voice& voice, Uint8* output, const Uint8* input, Uint32 length);
+
+    /**
+     * Frees retired samples the audio thread can no longer be using
+     */
+    void _collect();
+
+    /**
+     * Picks the voice for another instance of clip
+     * 
+     * \returns the voice, or -1 if the clip's steal policy won't allow one
+     */
+    int _allocateVoice(Clip& clip);
+
+    Clip* _getClip(const std::string& id);
+
+    /**
+     * Returns the voice a handle refers to, or -1 if it has finished
+     */
+    int _getVoice(VoiceHandle handle);
+
+    /**
+     * Returns the voices playing or paused instances of clip
+     */
+    std::vector<int> _getVoices(const Clip* clip);
+
+    bool _isActive(int voice);
+
+    /**
+     * Makes sample the sound for id, adding the sound if needed
+     */
+    bool _publish(const std::string& id, std::unique_ptr<Sample> sample);
+
+    /**
+     * Asks the decoder thread to move a stream
+     * 
+     * \returns the serial the stream will have once it has moved
+     */
+    Uint32 _requestSeek(Stream& stream, Uint64 frame);
+
+    void _retire(std::unique_ptr<Sample> sample);
+    bool _send(const Command& command);
+    bool _stopVoice(int voice);
+
+    /**
+     * Tops up a stream's ring buffer, called by the decoder thread
+     */
+    void _fillStream(Stream& stream);
+    void _streamLoop();
+
     std::string _resourcePath;
 
     SDL_AudioSpec _obtainedSpec;
-    SDL_AudioStream* _stream;
+    SDL_AudioStream* _stream = nullptr;
     SDL_AudioDeviceID _deviceId;
     std::string _deviceName;
-    std::map<std::string, AudioData> _audioDataMap;
 
+    // Main thread
+    std::map<std::string, Clip> _clips;
+    Instance _instances[MAX_VOICES];
+    Uint64 _started = 0;
+    std::vector<std::pair<Uint64, std::unique_ptr<Sample>>> _retired;
+    Uint64 _sent = 0;
+    Uint32 _sequence = 0;
+
+    // Shared
+    SpscQueue<Command, COMMAND_QUEUE_SIZE> _commands;
+    std::atomic<Uint64> _processed { 0 };
+
+    // Audio thread
+    Voice _voices[MAX_VOICES];
+    std::vector<Uint8> _mixBuffer;
+
+    // Decoder thread
+    std::thread _streamThread;
+    std::mutex _streamMutex;
+    std::condition_variable _streamCondition;
+    std::vector<Stream*> _streams;
+    bool _streaming = false;
   };
 }
 
@@ -0,0 +1,158 @@
+#ifndef SGI_BUNDLE_H
+#define SGI_BUNDLE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+namespace SGI {
+  /**
+   * A packed file of resources
+   *
+   * Bundles are created by widgets-pack from the resources directory.
+   * The file starts with a table of contents sorted by name, followed
+   * by the data of each entry. The file is memory mapped, so opening a
+   * bundle reads nothing but the table of contents, and entries that
+   * are stored uncompressed are served straight from the mapping.
+   * Compressed entries are decompressed the first time they are used
+   * and kept for the life of the bundle.
+   *
+   * Mounted bundles are searched by openResource, which every loader
+   * uses, before falling back to loose files.
+   */
+  class Bundle {
+  public:
+    enum class Compression : Uint16 {
+      None = 0,
+      LZ = 1,
+    };
+
+    /**
+     * The start of a bundle file
+     *
+     * Followed by count entries sorted by name, then namesSize bytes of
+     * entry names, then the entry data. Everything is little endian.
+     */
+    struct Header {
+      char magic[4];
+      Uint32 version;
+      Uint32 count;
+      Uint32 namesSize;
+    };
+
+    struct Entry {
+      Uint64 offset;              // from the start of the file
+      Uint64 size;                // once decompressed
+      Uint64 storedSize;          // in the file
+      Uint32 nameOffset;          // from the start of the names
+      Uint16 nameLength;
+      Uint16 compression;
+    };
+
+    static constexpr char MAGIC[4] = {'S', 'G', 'I', 'B'};
+    static const Uint32 VERSION = 1;
+
+    ~Bundle();
+
+    void operator=(const Bundle &) = delete;
+
+    /**
+     * Opens a bundle
+     *
+     * \param fileName the path of the bundle
+     * \returns the bundle, or nullptr if it could not be opened
+     */
+    static std::shared_ptr<Bundle> open(const std::string& fileName);
+
+    bool contains(const std::string& name);
+
+    /**
+     * Returns the data of an entry
+     *
+     * The data belongs to the bundle and is valid until it is destroyed.
+     *
+     * \param name the path of the entry, relative to the resources directory
+     * \param size set to the size of the data
+     * \returns the data, or nullptr if there is no entry with the name
+     */
+    const void* getData(const std::string& name, size_t* size);
+
+    std::vector<std::string> getNames();
+
+    /**
+     * Opens a read only stream over an entry
+     *
+     * \returns the stream, or nullptr if there is no entry with the name
+     */
+    SDL_IOStream* openIO(const std::string& name);
+
+    /**
+     * Adds a bundle to the ones searched by openResource
+     *
+     * Bundles mounted later are searched first. Mounted bundles are
+     * never closed, so data returned from them is always valid.
+     *
+     * \returns true if the bundle was opened
+     */
+    static bool mount(const std::string& fileName);
+
+    /**
+     * Returns the data of a resource in a mounted bundle
+     *
+     * \returns the data, or nullptr if no mounted bundle has the resource
+     */
+    static const void* getResource(const std::string& name, size_t* size);
+
+    /**
+     * Opens a resource from the mounted bundles or from disk
+     *
+     * Safe to call from any thread.
+     *
+     * \param path the directory loose files are in
+     * \param name the path of the resource, relative to path
+     * \returns the stream, or nullptr if the resource was not found
+     */
+    static SDL_IOStream* openResource(const std::string& path, const std::string& name);
+
+    /**
+     * Compresses data for an LZ entry
+     *
+     * \returns the compressed data, empty if it would not be smaller
+     */
+    static std::vector<Uint8> compress(const Uint8* data, size_t size);
+
+    /**
+     * Decompresses an LZ entry
+     *
+     * \returns true if exactly outputSize bytes were decompressed
+     */
+    static bool decompress(const Uint8* data, size_t size, Uint8* output, size_t outputSize);
+
+  private:
+    Bundle() { };
+
+    static std::mutex _mountMutex;
+    static std::vector<std::shared_ptr<Bundle>> _mounted;
+
+    const Uint8* _data = nullptr;
+    size_t _size = 0;
+    void* _mapping = nullptr;
+    void* _loaded = nullptr;
+
+    const Entry* _entries = nullptr;
+    Uint32 _count = 0;
+    const char* _names = nullptr;
+
+    std::mutex _mutex;
+    std::map<Uint32, std::unique_ptr<Uint8[]>> _decompressed;
+
+    const Entry* _find(const std::string& name);
+  };
+
+  using BundlePtr = std::shared_ptr<Bundle>;
+}
+
+#endif // SGI_BUNDLE_H
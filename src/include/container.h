@@ -11,6 +11,7 @@ namespace SGI {
   public:
     friend class OptionGroup;
     friend class Panel;
+    friend class Widget;
     friend class Window;
 
     friend bool operator==(const Widget& lhs, const Widget& rhs);
@@ -40,7 +41,7 @@ namespace SGI {
 
     static std::shared_ptr<Container> create();
 
-    ~Container() { };
+    ~Container();
 
     /**
      * Add a child widget
@@ -91,6 +92,21 @@ namespace SGI {
      */
     virtual void removeAll();
 
+    /**
+     * Returns true if the container caches its rendering
+     */
+    bool isCached();
+
+    /**
+     * Render the container and its children once into a texture
+     * 
+     * The cached texture is drawn until a child is invalidated, which
+     * turns a static subtree into a single draw call.
+     *
+     * \param value true to cache the rendering.
+     */
+    void setCached(bool value = true);
+
     void setConstraint(Widget::ConstraintType constraint, int minValue, int maxValue) override;
 
     void setConstraint(Container::ConstraintType constraint, int minValue, int maxValue);
@@ -134,14 +150,28 @@ namespace SGI {
   protected:
     Container();
 
+    void _draw(double deltaTime) override;
+    bool _processPointerEvent(const SDL_Event *event) override;
     void _render(double deltaTime) override;
     void _renderOverlay(double deltaTime) override;
     void _setBounds(SDL_Rect& bounds) override;
     void _setRoot(std::shared_ptr<SGI::Window> root) override;
     void _setRenderer(std::shared_ptr<SDL_Renderer> renderer) override;
+    void _setTheme(const Theme* theme) override;
+    void _updateLayout() override;
 
   private:
     std::vector<WidgetPtr> _children;
+
+    /**
+     * Working rects used while laying out the children
+     * 
+     * Children are only given their final bounds once, so they are
+     * not invalidated for intermediate layout steps.
+     */
+    std::vector<SDL_Rect> _childRects;
+    std::vector<int> _childRoom;
+    std::vector<int> _childRoomSorted;
     Direction _Direction = Row;
 
     SpaceContent _spaceContentType = SpaceContent::Between;
@@ -149,13 +179,26 @@ namespace SGI {
     Constraint _spaceingConstraint;
     int _spacing = 0;
 
-    std::string _themeName = "Dark";
+    bool _cached = false;
+    bool _cacheValid = false;
+    std::shared_ptr<SDL_Texture> _cacheTexture;
+    int _cacheWidth = 0;
+    int _cacheHeight = 0;
 
     void _calculateChildrenBounds();
     int _calculateChildrenBoundsRow();
     int _calculateChildrenBoundsColumn();
     int _calculateChildrenBoundsStack();
 
+    /**
+     * Grows the children and then the spacing to fill the main axis
+     * 
+     * \param available the size of the content area on the main axis
+     * \param horizontal true to grow the widths, false the heights
+     * \returns the space left over
+     */
+    int _distributeSpace(int available, bool horizontal);
+
     void _findRecursive(const std::string& name, std::vector<WidgetPtr>& result) const;
 
     bool _overflowTop = false;
@@ -0,0 +1,130 @@
+#ifndef SGI_DRAW_LIST_H
+#define SGI_DRAW_LIST_H
+
+#include <SDL3/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+namespace SGI {
+  /**
+   * A buffer of draw commands for a renderer
+   *
+   * While a DrawList is recording widgets append fills, geometry and
+   * textures to it instead of calling SDL directly. When it is flushed
+   * consecutive commands that share a texture, clip and blend mode are
+   * merged into a single SDL_RenderGeometry call.
+   */
+  class DrawList {
+  public:
+    struct Stats {
+      size_t commands = 0;
+      size_t batches = 0;
+      size_t calls = 0;
+    };
+
+    /**
+     * Returns the DrawList recording for a renderer
+     *
+     * \returns the DrawList or nullptr if draws should go straight to SDL
+     */
+    static DrawList* get(SDL_Renderer* renderer);
+
+    /**
+     * Starts recording
+     *
+     * \param renderer the renderer the commands are flushed to
+     * \param clip the clip rect in effect until the first clip command
+     */
+    void begin(SDL_Renderer* renderer, const SDL_Rect* clip = nullptr);
+
+    /**
+     * Flushes the remaining commands and stops recording
+     */
+    void end();
+
+    /**
+     * Issues the recorded commands to the renderer
+     *
+     * Must be called before drawing directly or changing the renderer's
+     * state, like switching the render target. Afterwards the renderer
+     * is clipped to the current clip rect.
+     */
+    void flush();
+
+    void fillRect(const SDL_FRect& rect, SDL_Color color);
+
+    void geometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices);
+
+    /**
+     * Returns the counts for the last frame recorded
+     */
+    Stats getStats();
+
+    void popClip();
+
+    /**
+     * Pushes a clip rect, intersected with the current one
+     */
+    void pushClip(const SDL_Rect& rect);
+
+    /**
+     * Replaces the current clip rect
+     *
+     * \param rect the clip rect or nullptr to disable clipping
+     */
+    void setClip(const SDL_Rect* rect);
+
+    /**
+     * Appends a textured quad
+     *
+     * The texture's color and alpha mod are baked into the vertices.
+     *
+     * \param source the source rect or nullptr for the whole texture
+     * \param angle the rotation in degrees around the center of destination
+     */
+    void texture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination, double angle = 0.0);
+
+  private:
+    struct Clip {
+      bool enabled;
+      SDL_Rect rect;
+    };
+
+    struct Batch {
+      SDL_Texture* texture;
+      SDL_BlendMode blendMode;
+      size_t clip;
+      size_t firstVertex;
+      int vertexCount;
+      size_t firstIndex;
+      int indexCount;
+    };
+
+    static std::unordered_map<SDL_Renderer*, DrawList*> _recording;
+
+    SDL_Renderer* _renderer = nullptr;
+
+    std::vector<SDL_Vertex> _vertices;
+    std::vector<int> _indices;
+    std::vector<Batch> _batches;
+
+    std::vector<Clip> _clips;
+    std::vector<size_t> _clipStack;
+    size_t _clip = 0;
+
+    /**
+     * Forces the clip to be set on the next flush
+     */
+    bool _clipApplied = false;
+    size_t _appliedClip = 0;
+
+    Stats _stats;
+    Stats _lastStats;
+
+    void _append(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices);
+    static bool _sameClip(const Clip& a, const Clip& b);
+    void _useClip(const Clip& clip);
+  };
+}
+
+#endif // SGI_DRAW_LIST_H
@@ -4,6 +4,8 @@
 #include <unordered_map>
 #include <SDL3/SDL.h>
 #include <string>
+#include <vector>
+#include "theme.h"
 
 namespace SGI {
   
@@ -12,58 +14,102 @@ namespace SGI {
 
     ~Flat() { };
 
-    virtual void setTheme(std::string name) = 0;
+    /**
+     * Sets the theme by name
+     * 
+     * Unknown names fall back to the default theme.
+     */
+    virtual void setTheme(const std::string& name);
 
   protected:
     Flat();
 
-    struct ButtonColors {
-      SDL_Color text;
-      SDL_Color fill;
-      SDL_Color border;
+    /**
+     * Takes the widget's colors from a theme
+     * 
+     * \param theme a theme from the Themes registry, never nullptr.
+     */
+    virtual void _setTheme(const Theme* theme) = 0;
+
+    void _drawArc(SDL_Renderer* renderer, int centerX, int centerY, int radius, int startAngle, int endAngle, int lineWidth, SDL_Color lineColor, SDL_Color fillColor, bool filled);
+    void _drawChevron(SDL_Renderer* renderer, SDL_Point center, int size, double angle, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth);
+    void _drawRoundedRect(SDL_Renderer* renderer, SDL_Rect bounds, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth, int cornerRadius);
+
+  private:
+    enum class ShapeType {
+      Arc,
+      Chevron,
+      RoundedRect,
     };
 
-    struct ButtonStateColors {
-      ButtonColors defaultColor;
-      ButtonColors hoverColor;
-      ButtonColors pressedColor;
-      ButtonColors disabledColor;
+    /**
+     * Identifies a tessellated shape
+     * 
+     * Angles are in tenths of a degree. Shapes are tessellated around
+     * the origin so the same mesh is reused wherever it is drawn.
+     */
+    struct ShapeKey {
+      ShapeType type;
+      int w;
+      int h;
+      int radius;
+      int lineWidth;
+      bool filled;
+      int startAngle;
+      int endAngle;
+
+      bool operator==(const ShapeKey& other) const
+      {
+        return type == other.type && w == other.w && h == other.h && radius == other.radius &&
+               lineWidth == other.lineWidth && filled == other.filled &&
+               startAngle == other.startAngle && endAngle == other.endAngle;
+      }
     };
 
-    struct ButtonStyles {
-      ButtonStateColors primary;
-      ButtonStateColors secondary;
-      ButtonStateColors warning;
-      ButtonStateColors info;
-      ButtonStateColors danger;
+    struct ShapeKeyHash {
+      size_t operator()(const ShapeKey& key) const
+      {
+        size_t hash = static_cast<size_t>(key.type);
+        for (int value : {key.w, key.h, key.radius, key.lineWidth, static_cast<int>(key.filled), key.startAngle, key.endAngle}) {
+          hash ^= std::hash<int>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+      }
     };
 
-    struct Colors {
-      SDL_Color accentBorderColor;
-      SDL_Color accentFillColor;
-      SDL_Color backgroundColor;
-      SDL_Color borderColor;
-      SDL_Color fillColor;
-      SDL_Color focusedBorderColor;
-      SDL_Color textColor;
-      SDL_Color textSelectColor;
+    /**
+     * A vertex of a tessellated shape
+     * 
+     * The color is picked when the shape is drawn, line vertices use
+     * the line color and the others the fill color. Coverage scales
+     * the alpha to anti-alias the edges.
+     */
+    struct ShapeVertex {
+      SDL_FPoint position;
+      bool line;
+      float coverage;
     };
 
-    struct Theme {
-      std::string name;
-      ButtonStyles buttons;
-      Colors colors;
+    struct ShapeMesh {
+      std::vector<ShapeVertex> vertices;
+      std::vector<int> indices;
     };
-    
-    std::unordered_map<std::string, Theme> _themes;
 
-    const Theme& _getTheme(const std::string& themeName) const;
+    static const size_t MAX_SHAPES = 512;
+    static std::unordered_map<ShapeKey, ShapeMesh, ShapeKeyHash> _shapes;
+    static std::vector<SDL_Vertex> _shapeVertices;
 
-    void _drawArc(SDL_Renderer* renderer, int centerX, int centerY, int radius, int startAngle, int endAngle, int lineWidth, SDL_Color lineColor, SDL_Color fillColor, bool filled);
-    void _drawChevron(SDL_Renderer* renderer, SDL_Point center, int size, double angle, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth);
-    void _drawRoundedRect(SDL_Renderer* renderer, SDL_Rect bounds, SDL_Color lineColor, SDL_Color fillColor, bool filled, int lineWidth, int cornerRadius);
+    void _addFan(ShapeMesh& mesh, SDL_FPoint center, const std::vector<SDL_FPoint>& contour, bool closed);
+    void _addRing(ShapeMesh& mesh, const std::vector<SDL_FPoint>& outer, float outerCoverage, const std::vector<SDL_FPoint>& inner, float innerCoverage, bool closed);
+    std::vector<SDL_FPoint> _arcContour(float radius, float startAngle, float endAngle, int segments);
+    const ShapeMesh& _getShape(const ShapeKey& key);
+    std::vector<SDL_FPoint> _offsetContour(const std::vector<SDL_FPoint>& contour, float inset);
+    void _renderShape(SDL_Renderer* renderer, const ShapeMesh& mesh, float x, float y, SDL_Color lineColor, SDL_Color fillColor);
+    std::vector<SDL_FPoint> _roundedRectContour(float w, float h, float radius, float inset, int segments);
+    ShapeMesh _tessellateArc(const ShapeKey& key);
+    ShapeMesh _tessellateChevron(const ShapeKey& key);
+    ShapeMesh _tessellateRoundedRect(const ShapeKey& key);
 
-  private:
     SDL_FPoint _rotatePoint(SDL_FPoint point, SDL_Point origin, double angle);
     double _degreesToRadians(double degrees);
     SDL_Color _hexToSDLColor(const std::string& hex) const;
@@ -39,14 +39,11 @@ namespace SGI {
     void setRadius(int value);
     void setStyle(const Style value);
 
-    void setTheme(std::string name) override;
-
   protected:
     FlatButton() { };
 
   private:
     bool _outline = false;
-    Flat::Theme _theme;
     Style _style = Style::Primary;
     bool _disabled = false;
 
@@ -68,14 +65,15 @@ namespace SGI {
 
     std::string _label = "";
     SDL_Texture* _textTexture = nullptr;
-    SDL_Texture* _textTextureHover = nullptr;
-    SDL_Texture* _textTexturePressed = nullptr;
     float _textWidth = 0;
     float _textHeight = 0;
 
     int _radius = 6;
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
+
+    void _renderLabel(SDL_Color color, SDL_FRect& position);
 
     void _updateLabel();
 
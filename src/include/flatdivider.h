@@ -24,8 +24,6 @@ namespace SGI {
     int getSize();
     void setDirection(Direction direction);
     void setSize(int size);
-
-    void setTheme(std::string name) override;
   
   protected:
     FlatDivider();
@@ -40,6 +38,7 @@ namespace SGI {
 
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
   };
   using FlatDividerPtr = std::shared_ptr<SGI::FlatDivider>;
 }
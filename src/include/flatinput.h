@@ -14,8 +14,8 @@ namespace SGI {
 
     ~FlatInput();
 
-    std::string addChangeListener(const Widget::Callback& handler);
-    void removeChangeListener(const std::string& id);
+    Uint64 addChangeListener(const Widget::Callback& handler);
+    void removeChangeListener(Uint64 handle);
 
     std::string getFontName();
     double getFontSize();
@@ -30,8 +30,6 @@ namespace SGI {
     void setFontSize(double fontSize);
     void setRadius(int value);
     void setValue(const std::string& value);
-
-    void setTheme(std::string name) override;
   
   protected:
     FlatInput() { };
@@ -64,12 +62,13 @@ namespace SGI {
     float _textHeight = 0;
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
     int _getCursorIndexFromMouse();
     void _removeSelection();
     void _updateLabel();
     void _updatePosition();
 
-    std::unordered_map<std::string, Callback> _changeHandelers;
+    Listeners<std::shared_ptr<Window>, std::shared_ptr<Widget>> _changeListeners;
 
   };
   using FlatInputPtr = std::shared_ptr<SGI::FlatInput>;
@@ -31,8 +31,6 @@ namespace SGI {
     void setFontSize(double fontSize);
     void setJustification(TextJustification justification);
     void setLabel(const std::string& value);
-
-    void setTheme(std::string name) override;
   
   protected:
     FlatLabel() { };
@@ -52,6 +50,7 @@ namespace SGI {
     float _textHeight = 0;
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
     void _updateLabel();
 
   };
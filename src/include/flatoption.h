@@ -22,8 +22,8 @@ namespace SGI {
 
     ~FlatOption();
 
-    std::string addChangeListener(const Widget::Callback& handler);
-    void removeChangeListener(const std::string& id);
+    Uint64 addChangeListener(const Widget::Callback& handler);
+    void removeChangeListener(Uint64 handle);
 
     std::string getFontName();
     double getFontSize();
@@ -36,8 +36,6 @@ namespace SGI {
     void setFontSize(double fontSize);
     void setLabel(const std::string& value);
     void setValue(bool value);
-
-    void setTheme(std::string name) override;
   
   protected:
     FlatOption() { };
@@ -58,9 +56,10 @@ namespace SGI {
     float _textHeight = 0;
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
     void _updateLabel();
 
-    std::unordered_map<std::string, Callback> _changeHandelers;
+    Listeners<std::shared_ptr<Window>, std::shared_ptr<Widget>> _changeListeners;
 
   };
   using FlatOptionPtr = std::shared_ptr<SGI::FlatOption>;
@@ -19,7 +19,7 @@ namespace SGI {
     void setOutline(bool value);
     void setRadius(int value);
 
-    void setTheme(std::string name) override;
+    void setTheme(const std::string& name) override;
   
   protected:
     FlatPanel() { };
@@ -34,6 +34,7 @@ namespace SGI {
 
     void _render(double deltaTime) override;
     void _renderOverlay(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
 
   };
   using FlatPanelPtr = std::shared_ptr<SGI::FlatPanel>;
@@ -14,8 +14,8 @@ namespace SGI {
 
     ~FlatSelect();
 
-    std::string addChangeListener(const Widget::Callback& handler);
-    void removeChangeListener(const std::string& id);
+    Uint64 addChangeListener(const Widget::Callback& handler);
+    void removeChangeListener(Uint64 handle);
 
     std::string getFontName();
     double getFontSize();
@@ -33,8 +33,6 @@ namespace SGI {
     void setRadius(int value);
     void setValue(const std::string& value);
 
-    void setTheme(std::string name) override;
-
   protected:
     FlatSelect() { };
 
@@ -53,8 +51,8 @@ namespace SGI {
     std::vector<std::string> _options;
 
     SDL_Texture* _optionsTexture = nullptr;
-    SDL_Rect _optionsBounds;
-    SDL_Rect _optionsContent;
+    SDL_Rect _optionsBounds = {0, 0, 0, 0};
+    SDL_Rect _optionsContent = {0, 0, 0, 0};
     float _optionsWidth = 0;
     float _optionsHeight = 0;
     float _optionItemHeight = 0;
@@ -73,17 +71,24 @@ namespace SGI {
 
     int _radius = 6;
 
+    /**
+     * Invalidates the select and the options overlay
+     */
+    void _invalidateOverlay();
+
     bool _isMouseOverOverlay();
 
     void _render(double deltaTime) override;
     void _renderOverlay(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
 
     void _updateLabel();
     void _updateNoOptionsLadel();
     void _updateOptionsLadel();
+    void _updateOptionsBounds();
     void _updateSelected();
 
-    std::unordered_map<std::string, Callback> _inputHandelers;
+    Listeners<std::shared_ptr<Window>, std::shared_ptr<Widget>> _changeListeners;
 
   };
   using FlatSelectPtr = std::shared_ptr<SGI::FlatSelect>;
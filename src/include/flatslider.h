@@ -20,8 +20,8 @@ namespace SGI {
 
     ~FlatSlider();
 
-    std::string addChangeListener(const Widget::Callback& handler);
-    void removeChangeListener(const std::string& id);
+    Uint64 addChangeListener(const Widget::Callback& handler);
+    void removeChangeListener(Uint64 handle);
 
     int getValue();
 
@@ -30,7 +30,6 @@ namespace SGI {
     void setMaxValue(int maxValue);
     void setMinValue(int minValue);
     void setOrientation(Orientation orientation);
-    void setTheme(std::string name) override;
     void setValue(int value);
 
   protected:
@@ -55,8 +54,9 @@ namespace SGI {
     bool _dragging = false;
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
 
-    std::unordered_map<std::string, Callback> _changeHandelers;
+    Listeners<std::shared_ptr<Window>, std::shared_ptr<Widget>> _changeListeners;
 
   };
   using FlatSliderPtr = std::shared_ptr<SGI::FlatSlider>;
@@ -3,6 +3,7 @@
 
 #include <SDL3/SDL.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "flat.h"
 #include "widget.h"
@@ -28,8 +29,6 @@ namespace SGI {
     void setFontSize(double fontSize);
     void setResourcePath(std::string path);
     void setValue(const std::string& value);
-
-    void setTheme(std::string name) override;
   
   protected:
     FlatText();
@@ -41,7 +40,6 @@ namespace SGI {
       std::string fontName;
       int fontPoints;
       std::string content;
-      int width;
       bool bold;
       bool italic;
       bool underline;
@@ -50,15 +48,35 @@ namespace SGI {
     };
     std::vector<Token> _tokens;
 
-    struct DisplayTextures {
-      SDL_Texture* texture;
+    /**
+     * A word or separator within a token
+     */
+    struct Piece {
+      size_t token;
+      size_t offset;
+      size_t length;
       int width;
       int height;
     };
+    std::vector<Piece> _pieces;
+
+    /**
+     * A laid out line of text
+     * 
+     * The line index covers the whole document while textures are
+     * only created for the lines that are in view.
+     */
+    struct Line {
+      size_t firstPiece;
+      size_t pieceCount;
+      int y;
+      int height;
+    };
+    std::vector<Line> _lines;
 
     std::string _resourcePath;
 
-    std::vector<std::vector<DisplayTextures>> _lineTextures;
+    std::unordered_map<size_t, std::vector<SDL_Texture*>> _lineTextures;
     int _totalHeight = 0;
     int _totalOffset = 0;
 
@@ -70,7 +88,10 @@ namespace SGI {
     SDL_Color _textColor = {225, 225, 225, 255};
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
+    void _clearTextures();
     void _createTokens(const std::string& str, SDL_Color defaultTextColor, SDL_Color defaultBgColor, const std::string& defaultFontName, int defaultFontSize);
+    void _renderLine(size_t index, int x, int y);
     void _updateContent();
 
   };
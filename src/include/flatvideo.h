@@ -20,7 +20,6 @@ namespace SGI {
     void setLocationCallback(std::function<void(std::shared_ptr<Window>, std::shared_ptr<Widget>, float currentTime, float maxTime)> callback);
     void setRepeat(bool value);
     void setResourcePath(std::string path);
-    void setTheme(std::string name) override;
 
     ~FlatVideo();
 
@@ -40,6 +39,7 @@ namespace SGI {
     void _init();
 
     void _render(double deltaTime) override;
+    void _setTheme(const Theme* theme) override;
 
   };
   using FlatVideoPtr = std::shared_ptr<SGI::FlatVideo>;
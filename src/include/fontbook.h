@@ -3,30 +3,212 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include <list>
 #include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "assetloader.h"
 
 namespace SGI {
   class FontBook {
   public:
+    struct MeasureStats {
+      uint64_t hits = 0;
+      uint64_t glyphHits = 0;
+      uint64_t misses = 0;
+      size_t entries = 0;
+      size_t capacity = 0;
+    };
+
     void operator=(const FontBook &) = delete;
 
     static void setFontPath(const std::string path);
     static void addFont(const std::string name, const std::string fontFile);
     static void addFontSize(const std::string name, int ptSize);
-    static bool measure(const std::string name, int ptSize, const std::string text, int *width, int *height);
+
+    /**
+     * Adds a font size without blocking
+     * 
+     * The font file is read by the AssetLoader and the font is opened
+     * on the main thread, since SDL_ttf is not thread safe. Text drawn
+     * with the font before it is ready loads it synchronously.
+     * 
+     * \param callback called on the main thread when the font is added
+     * \returns the font's progress
+     */
+    static AssetPtr addFontSizeAsync(const std::string name, int ptSize, const AssetLoader::Callback& callback = nullptr);
+
+    /**
+     * Draws text using the glyph atlas
+     * 
+     * Glyphs are rasterized once per font, size and style into atlas
+     * pages shared by all widgets, and the text is drawn as batched
+     * quads. Drawing new text never allocates a texture.
+     * 
+     * \param renderer the renderer to draw with
+     * \param x the left of the text
+     * \param y the top of the text
+     * \returns true if the text was drawn
+     */
+    static bool draw(SDL_Renderer* renderer, const std::string name, int ptSize, const std::string text, const SDL_Color &fg, float x, float y, bool bold = false, bool italic = false, bool underline = false, bool strikethrough = false, bool overline = false);
+
+    /**
+     * Returns the measurement cache counters
+     * 
+     * hits are strings found in the cache, glyphHits are single
+     * characters found in the per glyph tables and misses are
+     * measurements that had to be done by SDL_ttf.
+     */
+    static MeasureStats getMeasureStats();
+
+    /**
+     * Returns true if widgets should draw text with the glyph atlas
+     */
+    static bool isGlyphAtlasEnabled();
+
+    /**
+     * Measures the size text will be rendered at
+     * 
+     * Results are kept in a least recently used cache so measuring the
+     * same text again does not go back to SDL_ttf.
+     * 
+     * \returns true if the text was measured
+     */
+    static bool measure(const std::string& name, int ptSize, const std::string& text, int *width, int *height, bool bold = false, bool italic = false);
+
+    /**
+     * Releases the glyph atlas pages created for a renderer
+     * 
+     * Must be called before the renderer is destroyed.
+     */
+    static void releaseRenderer(SDL_Renderer* renderer);
+
+    static void resetMeasureStats();
+
     static std::shared_ptr<SDL_Surface> render(const std::string name, int ptSize, const std::string text, const SDL_Color &fg, bool bold = false, bool italic = false, bool underline = false, bool strikethrough = false, bool overline = false);
 
+    /**
+     * Sets if widgets draw text with the glyph atlas
+     * 
+     * When disabled widgets render each string into its own texture.
+     */
+    static void setGlyphAtlasEnabled(bool value = true);
+
+    /**
+     * Sets the number of strings kept in the measurement cache
+     * 
+     * \param entries the maximum number of entries, 0 disables the cache
+     */
+    static void setMeasureCacheSize(size_t entries);
+
   private:
     FontBook();
     ~FontBook();
 
+    struct Glyph {
+      int page = -1;
+      SDL_FRect source = {0, 0, 0, 0};
+      int offsetX = 0;
+      int advance = 0;
+    };
+
+    struct GlyphKey {
+      TTF_Font* font;
+      int style;
+      Uint32 codepoint;
+
+      bool operator==(const GlyphKey& other) const
+      {
+        return font == other.font && style == other.style && codepoint == other.codepoint;
+      }
+    };
+
+    struct GlyphKeyHash {
+      size_t operator()(const GlyphKey& key) const
+      {
+        size_t hash = std::hash<const void*>()(key.font);
+        hash ^= (static_cast<size_t>(key.codepoint) << 2) + static_cast<size_t>(key.style) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+      }
+    };
+
+    struct GlyphPage {
+      std::shared_ptr<SDL_Texture> texture;
+      int shelfX = 1;
+      int shelfY = 1;
+      int shelfHeight = 0;
+      std::vector<SDL_Vertex> vertices;
+    };
+
+    struct GlyphAtlas {
+      std::vector<GlyphPage> pages;
+      std::unordered_map<GlyphKey, Glyph, GlyphKeyHash> glyphs;
+    };
+
+    static const int ATLAS_PAGE_SIZE = 1024;
+
+    using FontKey = std::pair<std::string, int>;
+
+    struct MeasureKey {
+      TTF_Font* font;
+      int style;
+      size_t hash;
+
+      bool operator==(const MeasureKey& other) const
+      {
+        return font == other.font && style == other.style && hash == other.hash;
+      }
+    };
+
+    struct MeasureKeyHash {
+      size_t operator()(const MeasureKey& key) const
+      {
+        size_t hash = std::hash<const void*>()(key.font);
+        hash ^= key.hash + static_cast<size_t>(key.style) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+      }
+    };
+
+    struct MeasureEntry {
+      std::string text;
+      int width;
+      int height;
+      std::list<MeasureKey>::iterator order;
+    };
+
+    struct GlyphSize {
+      int width = -1;
+      int height = 0;
+    };
+
+    static const Uint32 GLYPH_TABLE_SIZE = 256;
+
     static void initialize();
 
     static FontBook* _instance;
 
     std::string _fontpath;
     std::map<std::string, std::string> _fontFiles;
-    std::map<std::string, TTF_Font*> _fonts;
+    std::map<FontKey, TTF_Font*> _fonts;
+    std::map<FontKey, std::shared_ptr<void>> _fontData;
+
+    bool _glyphAtlasEnabled = false;
+    std::unordered_map<SDL_Renderer*, GlyphAtlas> _atlases;
+    std::vector<int> _indices;
+
+    size_t _measureCapacity = 2048;
+    std::unordered_map<MeasureKey, MeasureEntry, MeasureKeyHash> _measures;
+    std::list<MeasureKey> _measureOrder;
+    std::map<std::pair<TTF_Font*, int>, std::vector<GlyphSize>> _glyphSizes;
+    MeasureStats _measureStats;
+
+    void _addFont(const FontKey& key, TTF_Font* font, const std::shared_ptr<void>& data);
+    bool _addGlyphPage(SDL_Renderer* renderer, GlyphAtlas& atlas);
+    const Glyph* _getGlyph(SDL_Renderer* renderer, GlyphAtlas& atlas, TTF_Font* font, int style, Uint32 codepoint);
+    TTF_Font* _getFont(const std::string& name, int ptSize);
+    void _purgeMeasures(TTF_Font* font);
   };
 }
 
@@ -0,0 +1,171 @@
+#ifndef SGI_LISTENERS_H
+#define SGI_LISTENERS_H
+
+#include <algorithm>
+#include <functional>
+#include <SDL3/SDL.h>
+#include <vector>
+
+namespace SGI {
+  /**
+   * A list of handlers that are called together
+   *
+   * Handlers are kept in a vector in the order they were added and
+   * are identified by an integer handle, so calling them does not
+   * allocate or hash. Handlers may add or remove handlers, including
+   * themselves, while they are being called. Handlers removed during
+   * a call are skipped, handlers added during a call are first called
+   * the next time.
+   */
+  template<typename... Args>
+  class Listeners {
+  public:
+    using Handle = Uint64;
+    using Handler = std::function<bool(Args...)>;
+
+    /**
+     * Adds a handler
+     *
+     * \param handler the handler to call.
+     * \returns a handle that can be used to remove the handler, never 0.
+     */
+    Handle add(const Handler& handler)
+    {
+      Handle handle = _nextHandle++;
+      if (_calling > 0) {
+        _added.push_back({ handle, handler, true });
+      } else {
+        _slots.push_back({ handle, handler, true });
+      }
+      return handle;
+    }
+
+    /**
+     * Calls every handler in the order they were added
+     *
+     * \returns true if any handler returned true.
+     */
+    bool call(Args... args)
+    {
+      return _call(false, args...);
+    }
+
+    /**
+     * Calls handlers in the order they were added until one returns true
+     *
+     * \returns true if a handler returned true.
+     */
+    bool callUntilHandled(Args... args)
+    {
+      return _call(true, args...);
+    }
+
+    void clear()
+    {
+      if (_calling > 0) {
+        for (Slot& slot : _slots) {
+          slot.connected = false;
+        }
+        _added.clear();
+        _removed = true;
+      } else {
+        _slots.clear();
+      }
+    }
+
+    bool empty()
+    {
+      return size() == 0;
+    }
+
+    /**
+     * Removes a handler
+     *
+     * \param handle the handle returned by add.
+     * \returns true if the handler was found.
+     */
+    bool remove(Handle handle)
+    {
+      // Handles only grow, so both vectors are sorted by handle
+      auto byHandle = [](const Slot& slot, Handle handle) { return slot.handle < handle; };
+
+      auto it = std::lower_bound(_slots.begin(), _slots.end(), handle, byHandle);
+      if (it != _slots.end() && it->handle == handle && it->connected) {
+        if (_calling > 0) {
+          // The handler may be running, so only mark it
+          it->connected = false;
+          _removed = true;
+        } else {
+          _slots.erase(it);
+        }
+        return true;
+      }
+
+      it = std::lower_bound(_added.begin(), _added.end(), handle, byHandle);
+      if (it != _added.end() && it->handle == handle) {
+        _added.erase(it);
+        return true;
+      }
+
+      return false;
+    }
+
+    size_t size()
+    {
+      size_t count = _added.size();
+      for (const Slot& slot : _slots) {
+        if (slot.connected) {
+          ++count;
+        }
+      }
+      return count;
+    }
+
+  private:
+    struct Slot {
+      Handle handle;
+      Handler handler;
+      bool connected;
+    };
+
+    bool _call(bool untilHandled, Args... args)
+    {
+      bool result = false;
+      size_t count = _slots.size();
+
+      ++_calling;
+      for (size_t i = 0; i < count && !(untilHandled && result); ++i) {
+        if (_slots[i].connected && _slots[i].handler(args...)) {
+          result = true;
+        }
+      }
+      if (--_calling == 0) {
+        _compact();
+      }
+
+      return result;
+    }
+
+    void _compact()
+    {
+      if (_removed) {
+        _slots.erase(std::remove_if(_slots.begin(), _slots.end(), [](const Slot& slot) {
+          return !slot.connected;
+        }), _slots.end());
+        _removed = false;
+      }
+      if (!_added.empty()) {
+        _slots.insert(_slots.end(), _added.begin(), _added.end());
+        _added.clear();
+      }
+    }
+
+    std::vector<Slot> _added;
+    int _calling = 0;
+    Handle _nextHandle = 1;
+    bool _removed = false;
+    std::vector<Slot> _slots;
+  };
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef SGI_MIXKERNEL_H
+#define SGI_MIXKERNEL_H
+
+#include <string>
+#include <vector>
+
+namespace SGI {
+  /**
+   * The inner loops of the audio mixer
+   *
+   * Each loop has AVX2 and SSE2 versions on x86, a NEON version on ARM
+   * and a plain version for everything else. The best one the CPU
+   * supports is picked the first time a loop is used. Buffers hold
+   * interleaved stereo 32-bit floats and don't need to be aligned.
+   */
+  class MixKernel {
+  public:
+    /**
+     * Returns the name of the instruction set the loops use
+     */
+    static const char* getName();
+
+    /**
+     * Returns the names of the versions the CPU can run, best first
+     */
+    static std::vector<std::string> getNames();
+
+    /**
+     * Adds input to output with a gain for each channel
+     *
+     * The gains start at left and right and change by leftStep and
+     * rightStep every frame, so a change in gain is ramped instead of
+     * clicking.
+     *
+     * \param frames the number of stereo frames to mix
+     */
+    static void mix(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep);
+
+    /**
+     * Switches to another version, for tests and benchmarks
+     *
+     * Must not be called while audio is playing.
+     *
+     * \param name one of the names from getNames
+     * \returns false if the CPU can't run that version
+     */
+    static bool select(const std::string& name);
+
+    /**
+     * Bends loud samples smoothly into [-1, 1] instead of clipping them
+     *
+     * Samples within the knee at 0.8 are passed through unchanged.
+     *
+     * \param samples the number of floats in buffer
+     */
+    static void softClip(float* buffer, int samples);
+  };
+}
+
+#endif // SGI_MIXKERNEL_H
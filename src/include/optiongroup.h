@@ -13,12 +13,12 @@ namespace SGI {
   public:
     static std::shared_ptr<OptionGroup> create();
 
-    using OptionGroupCallback = std::function<bool(WindowPtr, std::vector<FlatOptionPtr>)>;
+    using OptionGroupCallback = std::function<bool(WindowPtr, const std::vector<FlatOptionPtr>&)>;
 
     ~OptionGroup() { };
 
-    std::string addChangeListener(const OptionGroupCallback& handler);
-    void removeChangeListener(const std::string& id);
+    Uint64 addChangeListener(const OptionGroupCallback& handler);
+    void removeChangeListener(Uint64 handle);
 
     /**
      * Add a child FlatOption wiget
@@ -45,7 +45,7 @@ namespace SGI {
   protected:
     OptionGroup() { };
 
-    std::unordered_map<std::string, std::string> _functionIds;
+    std::unordered_map<Uint64, Uint64> _functionIds;
 
     void addChild(WidgetPtr widget) override;
     void removeChild(WidgetPtr widget) override;
@@ -53,7 +53,7 @@ namespace SGI {
   private:
     bool _multiSelect = false;
 
-    std::unordered_map<std::string, OptionGroupCallback> _changeHandelers;
+    Listeners<WindowPtr, const std::vector<FlatOptionPtr>&> _changeListeners;
 
   };
   using OptionGroupPtr = std::shared_ptr<OptionGroup>;
@@ -0,0 +1,47 @@
+#ifndef SGI_PROFILER_H
+#define SGI_PROFILER_H
+
+#include <SDL3/SDL.h>
+
+namespace SGI {
+  /**
+   * Counters shared by everything that draws
+   *
+   * Textures passed to trackTexture are counted until SDL destroys
+   * them, which lets the debug overlay show how much texture memory
+   * the widgets are holding.
+   */
+  class Profiler {
+  public:
+    /**
+     * Returns the bytes of texture memory held by tracked textures
+     */
+    static size_t getTextureBytes();
+
+    /**
+     * Returns the number of tracked textures that have not been destroyed
+     */
+    static size_t getTextureCount();
+
+    /**
+     * Returns a high resolution time in milliseconds
+     */
+    static double milliseconds();
+
+    /**
+     * Counts a texture until it is destroyed
+     *
+     * \param texture the newly created texture, may be nullptr
+     * \returns the texture
+     */
+    static SDL_Texture* trackTexture(SDL_Texture* texture);
+
+  private:
+    static size_t _textureBytes;
+    static size_t _textureCount;
+
+    static void _releaseTexture(void* userdata, void* value);
+  };
+}
+
+#endif // SGI_PROFILER_H
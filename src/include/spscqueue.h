@@ -0,0 +1,60 @@
+#ifndef SGI_SPSCQUEUE_H
+#define SGI_SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace SGI {
+  /**
+   * A fixed size queue between one producer and one consumer thread
+   *
+   * push and pop never lock or allocate, so the queue can be used to
+   * talk to real time threads like the audio callback. Only one thread
+   * may push and only one thread may pop.
+   */
+  template<typename T, size_t Capacity>
+  class SpscQueue {
+  public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    /**
+     * Adds a value, called by the producer
+     *
+     * \returns false if the queue is full
+     */
+    bool push(const T& value)
+    {
+      size_t head = _head.load(std::memory_order_relaxed);
+      if (head - _tail.load(std::memory_order_acquire) == Capacity) {
+        return false;
+      }
+      _items[head & (Capacity - 1)] = value;
+      _head.store(head + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * Removes the oldest value, called by the consumer
+     *
+     * \returns false if the queue is empty
+     */
+    bool pop(T& value)
+    {
+      size_t tail = _tail.load(std::memory_order_relaxed);
+      if (tail == _head.load(std::memory_order_acquire)) {
+        return false;
+      }
+      value = _items[tail & (Capacity - 1)];
+      _tail.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+  private:
+    // Kept on separate cache lines so the threads don't share one
+    alignas(64) std::atomic<size_t> _head { 0 };
+    alignas(64) std::atomic<size_t> _tail { 0 };
+    T _items[Capacity];
+  };
+}
+
+#endif // SGI_SPSCQUEUE_H
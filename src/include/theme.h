@@ -0,0 +1,96 @@
+#ifndef SGI_THEME_H
+#define SGI_THEME_H
+
+#include <memory>
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SGI {
+  struct Theme {
+    struct ButtonColors {
+      SDL_Color text;
+      SDL_Color fill;
+      SDL_Color border;
+    };
+
+    struct ButtonStateColors {
+      ButtonColors defaultColor;
+      ButtonColors hoverColor;
+      ButtonColors pressedColor;
+      ButtonColors disabledColor;
+    };
+
+    struct ButtonStyles {
+      ButtonStateColors primary;
+      ButtonStateColors secondary;
+      ButtonStateColors warning;
+      ButtonStateColors info;
+      ButtonStateColors danger;
+    };
+
+    struct Colors {
+      SDL_Color accentBorderColor;
+      SDL_Color accentFillColor;
+      SDL_Color backgroundColor;
+      SDL_Color borderColor;
+      SDL_Color fillColor;
+      SDL_Color focusedBorderColor;
+      SDL_Color textColor;
+      SDL_Color textSelectColor;
+    };
+
+    std::string name;
+    ButtonStyles buttons;
+    Colors colors;
+  };
+
+  /**
+   * The themes shared by every widget
+   *
+   * Themes are stored once for the whole process and never change or
+   * move after they are added, so widgets keep a pointer to the theme
+   * they use instead of a copy. The "Dark" theme is always available.
+   */
+  class Themes {
+  public:
+    void operator=(const Themes &) = delete;
+
+    /**
+     * Adds a theme
+     *
+     * \param theme the theme to add, its name must not be in use.
+     * \returns the stored theme, or nullptr if the name is in use.
+     */
+    static const Theme* add(const Theme& theme);
+
+    /**
+     * Finds a theme by name
+     *
+     * \returns the theme, or nullptr if there is no theme with the name.
+     */
+    static const Theme* get(const std::string& name);
+
+    /**
+     * Returns the theme widgets use until one is set
+     */
+    static const Theme* getDefault();
+
+    /**
+     * Finds a theme by name, falling back to the default theme
+     */
+    static const Theme* resolve(const std::string& name);
+
+  private:
+    Themes() { };
+
+    static const Theme* _default;
+    static std::unordered_map<std::string, const Theme*> _names;
+    static std::vector<std::unique_ptr<Theme>> _themes;
+
+    static void _init();
+  };
+}
+
+#endif // SGI_THEME_H
@@ -1,13 +1,16 @@
 #ifndef SGI_WIDGET_H
 #define SGI_WIDGET_H
 
+#include <atomic>
 #include <functional>
 #include <SDL3/SDL.h>
 #include <string>
 #include <vector>
+#include "listeners.h"
 
 namespace SGI {
   class Container;
+  struct Theme;
   class Window;
 
   class Widget {
@@ -36,6 +39,13 @@ namespace SGI {
       Up,
     };
 
+    struct RenderProfile {
+      Uint64 frames = 0;        // times the widget was drawn while profiling
+      double lastTime = 0.0;    // milliseconds the last draw took, excluding children
+      double maxTime = 0.0;     // slowest draw in milliseconds, excluding children
+      double totalTime = 0.0;   // milliseconds of all draws, excluding children
+    };
+
     using MouseButtonCallback = std::function<bool(std::shared_ptr<Window>, std::shared_ptr<Widget>, uint8_t)>;
     using Callback = std::function<bool(std::shared_ptr<Window>, std::shared_ptr<Widget>)>;
 
@@ -48,16 +58,37 @@ namespace SGI {
      * within the bounds of the widget.
      *
      * \param handler the handler to call when the event is triggered.
-     * \returns an id that can be used to remove the handler.
+     * \returns a handle that can be used to remove the handler.
      */
-    std::string addMouseListener(const MouseEventType type, const MouseButtonCallback& handler);
+    Uint64 addMouseListener(const MouseEventType type, const MouseButtonCallback& handler);
 
     SDL_Rect getBounds();
 
     SDL_Rect getContentArea();
 
+    /**
+     * Returns the widget's id
+     * 
+     * Ids are assigned in order as widgets are constructed and are
+     * never reused, so they can be used as map keys.
+     */
+    Uint64 getId();
+
     std::string getName();
 
+    /**
+     * Returns how long the widget has taken to draw
+     * 
+     * Only collected while the root Window is profiling.
+     */
+    RenderProfile getRenderProfile();
+
+    /**
+     * Returns a UUIDv4 for the widget
+     * 
+     * The UUID is generated the first time it is asked for. Use getId
+     * to compare widgets.
+     */
     std::string getUUID();
 
     /**
@@ -79,9 +110,9 @@ namespace SGI {
     /**
      * Remve a handler from the list of mouse button down handlers
      *
-     * \param id the id of the handler that is to be removed.
+     * \param handle the handle of the handler that is to be removed.
      */
-    void removeMouseListener(const MouseEventType type, const std::string& id);
+    void removeMouseListener(const MouseEventType type, Uint64 handle);
 
     virtual void setConstraint(ConstraintType constraint, int minValue, int maxValue);
 
@@ -126,7 +157,7 @@ namespace SGI {
      * of the widget. Anything rendered outside of the
      * bounds may be over written in unexpected ways.
      */
-    SDL_Rect _bounds;
+    SDL_Rect _bounds = {0, 0, 0, 0};
 
     struct {
       Constraint width;
@@ -150,15 +181,152 @@ namespace SGI {
 
     std::unordered_map<Uint8, bool> _mouseButtonState;
 
-    std::string _generateShortCode();
+    /**
+     * Set to true while the widget changes how it looks every frame
+     * 
+     * Use _setAnimating to change this so the root Window is told.
+     */
+    bool _animating = false;
+
+    /**
+     * Set to true while the widget needs every pointer event
+     * 
+     * When the Window routes pointer events only to the widgets under
+     * the pointer, widgets that also react to the pointer outside of
+     * their bounds, like an open overlay, must capture it. Use
+     * _setPointerCapture to change this so the root Window is told.
+     */
+    bool _pointerCapture = false;
+
+    /**
+     * The theme the widget's colors come from
+     * 
+     * Points into the Themes registry and is never nullptr. Parents
+     * pass their theme to children as they are added.
+     */
+    const Theme* _theme;
+
+    /**
+     * The container this widget is a child of
+     * 
+     * This is assigned by the parent when adding the widget
+     * as a child and is set to nullptr when it is removed.
+     */
+    Container* _parent = nullptr;
+
+    /**
+     * Renders the widget
+     * 
+     * Parents call this rather than _render so widgets that keep a
+     * cached rendering of themselves can reuse it.
+     */
+    virtual void _draw(double deltaTime) { _render(deltaTime); };
+
+    /**
+     * Calls _draw, timing it when the root Window is profiling
+     */
+    void _drawProfiled(double deltaTime);
+
+    /**
+     * Fills a rect with a color
+     * 
+     * Goes through the Window's DrawList when it is batching.
+     */
+    void _fillRect(const SDL_FRect& rect, SDL_Color color);
+
+    /**
+     * Marks the widget as needing to be redrawn
+     * 
+     * When the Window is tracking damage only the invalidated regions
+     * are redrawn, so this must be called whenever anything that changes
+     * how the widget looks changes.
+     */
+    void _invalidate();
+
+    /**
+     * Marks a region as needing to be redrawn
+     * 
+     * Used by widgets that draw outside of their bounds, like overlays.
+     * 
+     * \param rect the region to redraw
+     */
+    void _invalidate(const SDL_Rect& rect);
+
+    /**
+     * Process a pointer event routed to the widget by the Window
+     * 
+     * Containers override this to handle the event themselves, as
+     * their children under the pointer have been routed it already.
+     */
+    virtual bool _processPointerEvent(const SDL_Event *event) { return processEvent(event); };
+
     virtual void _render(double deltaTime);
     virtual void _renderOverlay(double deltaTime) { };
+
+    /**
+     * Draws a texture
+     * 
+     * Goes through the Window's DrawList when it is batching.
+     * 
+     * \param source the part of the texture to draw or nullptr for all of it
+     * \param destination where to draw the texture
+     */
+    void _renderTexture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination);
+
+    /**
+     * Draws a texture tinted with a color
+     * 
+     * Text rendered in white can be drawn in any color this way, so a
+     * widget needs one texture for all of its states and colors.
+     * 
+     * \param color multiplied with the texture's colors and alpha
+     */
+    void _renderTexture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination, SDL_Color color);
+
+    /**
+     * The color to render text in when it is drawn tinted
+     * 
+     * Changing the text color or theme then doesn't render it again.
+     */
+    static const SDL_Color TINT_WHITE;
     
+    /**
+     * Marks the widget as changing every frame
+     * 
+     * While animating the Window redraws the widget's bounds every
+     * frame, even when nothing else has been invalidated.
+     */
+    void _setAnimating(bool value);
+
     virtual void _setBounds(SDL_Rect& bounds);
 
+    /**
+     * Routes all pointer events to the widget while value is true
+     */
+    void _setPointerCapture(bool value);
+
+    /**
+     * Sets the renderer's clip rect
+     * 
+     * Widgets must use this instead of SDL_SetRenderClipRect so that
+     * drawing stays inside the Window's damaged region.
+     * 
+     * \param rect the clip rect or nullptr to clip to the damaged region
+     */
+    void _setClipRect(const SDL_Rect* rect);
+
     virtual void _setRoot(std::shared_ptr<SGI::Window> root);
     virtual void _setRenderer(std::shared_ptr<SDL_Renderer> renderer);
 
+    /**
+     * Sets the theme the widget's colors come from
+     * 
+     * \param theme a theme from the Themes registry, never nullptr.
+     */
+    virtual void _setTheme(const Theme* theme);
+
+    virtual void _updateLayout() { };
+
   private:
     void _checkMouseInBounds();
 
@@ -170,7 +338,8 @@ namespace SGI {
      */
     SDL_Rect _contentArea;
 
-    std::unordered_map<MouseEventType, std::unordered_map<std::string, MouseButtonCallback>> _mouseHandlers;
+    // Indexed by MouseEventType
+    Listeners<std::shared_ptr<Window>, std::shared_ptr<Widget>, uint8_t> _mouseListeners[MouseEventType::Up + 1];
 
     bool _mouseOver;
 
@@ -182,6 +351,8 @@ namespace SGI {
      */
     std::string _name;
 
+    RenderProfile _renderProfile;
+
     /**
      * The renderer to use
      * 
@@ -193,8 +364,15 @@ namespace SGI {
 
     void _updateContentArea();
 
+    static std::atomic<Uint64> _nextId;
+
+    /**
+     * The id of the widget, it is used when compairing widgets
+     */
+    Uint64 _id;
+
     /**
-     * The UUIDv4 of the widget, it is used when compairing widgets
+     * The UUIDv4 of the widget, empty until getUUID is called
      */
     std::string _uuid;
 
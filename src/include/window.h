@@ -3,13 +3,20 @@
 
 #include <map>
 #include <SDL3/SDL.h>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "assetloader.h"
 #include "container.h"
+#include "drawlist.h"
 
 namespace SGI {
   class Window : public Container {
   public:
+    friend class Container;
+    friend class Widget;
+
     enum CursorType {
       DEFAULT,
       TEXT,
@@ -45,6 +52,25 @@ namespace SGI {
 
     ~Window() { };
 
+    struct FrameStats {
+      Uint64 frames = 0;          // frames drawn by run
+      Uint64 waits = 0;           // times run slept waiting for an event
+      double frameTime = 0.0;     // average milliseconds to handle events and draw a frame
+      double maxFrameTime = 0.0;  // slowest frame in milliseconds
+      double busyTime = 0.0;      // total milliseconds spent handling events and drawing
+      double idleTime = 0.0;      // total milliseconds spent waiting for events or pacing
+      double load = 0.0;          // busyTime as a fraction of the total time
+    };
+
+    struct Profile {
+      double frameTime = 0.0;     // milliseconds the last render took
+      double layoutTime = 0.0;    // milliseconds spent laying out since the render before it
+      double eventTime = 0.0;     // milliseconds spent processing events since the render before it
+      size_t drawCalls = 0;       // SDL calls made by the last render, only counted while batching
+      size_t textures = 0;        // textures alive, see Profiler
+      size_t textureBytes = 0;    // bytes held by those textures
+    };
+
     struct TextureSlice {
       int x1, x2, y1, y2;
     };
@@ -55,16 +81,89 @@ namespace SGI {
       int height;
       bool sliced;
       TextureSlice sliceInfo;
+      SDL_FRect source;           // where the image is in texture, textures from an atlas share a page
     };
 
     static std::shared_ptr<Window> create(const std::string& title, int width, int height);
 
+    /**
+     * Adds the textures described by an atlas file
+     * 
+     * The atlas file is JSON that lists the images to load, with their
+     * texture name, file and optional 9-slice insets. The images are
+     * packed into as few pages as fit in the atlas' page size, so the
+     * textures share GPU textures and draws of them can be batched.
+     * 
+     * \param fileName the atlas file, relative to the resource path
+     * \returns true if every image was added
+     */
+    bool addAtlas(const std::string& fileName);
+
     bool addCursor(CursorType cursorType, const std::string& fileName, const SDL_Point& hotspot = {0, 0});
 
+    /**
+     * Adds a cursor without blocking
+     * 
+     * The image is decoded by the AssetLoader and the cursor is created
+     * by run once it is ready. Until then the cursor type uses the
+     * system cursor.
+     * 
+     * \param callback called on the main thread when the cursor is added
+     * \returns the cursor's progress
+     */
+    AssetPtr addCursorAsync(CursorType cursorType, const std::string& fileName, const SDL_Point& hotspot = {0, 0}, const AssetLoader::Callback& callback = nullptr);
+
     bool addTexture(const std::string& textureName, const std::string& fileName, const TextureSlice& sliceInfo = {0, 0, 0, 0});
 
+    /**
+     * Adds a texture without blocking
+     * 
+     * The image is decoded by the AssetLoader and uploaded by run once
+     * it is ready. Until then renderTexture draws a placeholder in its
+     * place, and the window is redrawn when it arrives.
+     * 
+     * \param callback called on the main thread when the texture is added
+     * \returns the texture's progress
+     */
+    AssetPtr addTextureAsync(const std::string& textureName, const std::string& fileName, const TextureSlice& sliceInfo = {0, 0, 0, 0}, const AssetLoader::Callback& callback = nullptr);
+
+    /**
+     * Returns the draw command counts for the last frame
+     * 
+     * Only counted while draw batching is on.
+     */
+    DrawList::Stats getDrawStats();
+
+    /**
+     * Returns the timings collected by run
+     */
+    FrameStats getFrameStats();
+
+    /**
+     * Returns the frames per second run is limited to while animating
+     */
+    int getFrameRate();
+
+    /**
+     * Returns the timings of the last render
+     * 
+     * Only collected while profiling.
+     */
+    Profile getProfile();
+
     ContainerPtr getSidebar();
 
+    /**
+     * Returns the widgets that take the longest to draw
+     * 
+     * Widgets are ranked by their average draw time, excluding their
+     * children, while profiling.
+     * 
+     * \param count the most widgets to return
+     * \returns the widgets, slowest first
+     */
+    std::vector<WidgetPtr> getSlowestWidgets(size_t count);
+
     std::shared_ptr<TextureData> getTexture(const std::string& textureName);
 
     std::shared_ptr<SDL_Window> getWindow();
@@ -77,30 +176,143 @@ namespace SGI {
 
     bool isMouseOverSidebar();
 
+    /**
+     * Returns true if render, layout, event and widget timings are collected
+     */
+    bool isProfiling();
+
+    /**
+     * Returns true if pointer events are routed through the hit-test index
+     */
+    bool isPointerRouting();
+
+    /**
+     * Returns true if only damaged regions are redrawn
+     */
+    bool isDamageTracking();
+
+    /**
+     * Returns true if draws are batched through a DrawList
+     */
+    bool isDrawBatching();
+
     bool processEvent(const SDL_Event *event) override;
 
     void removeCursor(CursorType cursorType);
 
-    void render(bool present = true);
-
+    /**
+     * Render the window
+     * 
+     * When damage tracking is on only the regions invalidated since the
+     * last render are redrawn and nothing is drawn or presented if no
+     * widget has been invalidated or is animating.
+     * 
+     * \param present if true the frame is presented
+     * \returns true if a frame was drawn
+     */
+    bool render(bool present = true);
+
+    /**
+     * Render the window with a performance overlay
+     * 
+     * The overlay shows the last frame's timings, draw calls, texture
+     * memory and the slowest widgets. Turns profiling on.
+     * 
+     * \param present if true the frame is presented
+     */
     void renderDebug(bool present = true);
 
-    void renderTexture(std::string textureName, const SDL_FRect& destRect, double angle = 0.0, float scale = 1.0);
+    /**
+     * Resets the timings collected by run
+     */
+    void resetFrameStats();
+
+    /**
+     * Processes events and renders until the application quits
+     * 
+     * Frames are only drawn when a widget has been invalidated or is
+     * animating. Otherwise the loop sleeps until the next event arrives.
+     * While animating frames are paced by vsync when the renderer
+     * supports it and by the frame rate otherwise.
+     * 
+     * The loop ends on SDL_EVENT_QUIT or when stop is called.
+     */
+    void run();
+
+    /**
+     * Draws a texture added with addTexture or addAtlas
+     * 
+     * \param angle the rotation in degrees, ignored for sliced textures
+     * \param scale the scale of a sliced texture's corners
+     * \param color multiplied with the texture's colors and alpha
+     */
+    void renderTexture(std::string textureName, const SDL_FRect& destRect, double angle = 0.0, float scale = 1.0, SDL_Color color = {255, 255, 255, 255});
 
     void setBackgroundTexture(const std::string textureName);
 
     void setCursor(CursorType cursorType);
 
+    /**
+     * Enables redrawing only the damaged regions of the window
+     * 
+     * The window is drawn into a retained texture, so each frame only
+     * has to redraw the widgets that changed.
+     * 
+     * \param value true to track damage
+     */
+    void setDamageTracking(bool value = true);
+
+    /**
+     * Enables batching draws through a DrawList
+     * 
+     * Widgets record their draws during a frame and they are issued
+     * at the end of it, merged into as few SDL calls as possible.
+     * 
+     * \param value true to batch draws
+     */
+    void setDrawBatching(bool value = true);
+
     void setFocused(std::shared_ptr<Widget>);
 
+    /**
+     * Limits how often run draws frames while animating
+     * 
+     * \param fps the frames per second, 0 for no limit
+     */
+    void setFrameRate(int fps);
+
+    /**
+     * Enables routing pointer events through a hit-test index
+     * 
+     * Instead of every widget being given every mouse event, they are
+     * only given to the widgets under the pointer, the widgets the
+     * pointer just left, the focused widget and the widgets holding a
+     * mouse button or capturing the pointer. Other events are still
+     * given to every widget.
+     * 
+     * \param value true to route pointer events
+     */
+    void setPointerRouting(bool value = true);
+
+    /**
+     * Enables collecting render, layout, event and widget timings
+     * 
+     * \param value true to profile
+     */
+    void setProfiling(bool value = true);
+
     void setResourcePath(std::string path);
 
-    void setTheme(const std::string& name) override;
+    /**
+     * Makes run return after the current frame
+     */
+    void stop();
 
   protected:
     Window(const std::string& title, int width, int height);
 
     void _setBounds(SDL_Rect& bounds) override;
+    void _setTheme(const Theme* theme) override;
 
   private:
     Uint64 _lastRenderCount = 0;
@@ -116,9 +328,149 @@ namespace SGI {
 
     std::string _backgroundTexture;
 
+    bool _damageTracking = false;
+
+    /**
+     * True while rendering a damaged frame, widgets clip to _damageRect
+     */
+    bool _damageActive = false;
+    SDL_Rect _damageRect = {0, 0, 0, 0};
+
+    /**
+     * The union of all regions invalidated since the last render
+     */
+    bool _damaged = false;
+    SDL_Rect _damage = {0, 0, 0, 0};
+
+    /**
+     * True when something was invalidated since the last render,
+     * whether or not damage is being tracked
+     */
+    bool _needsRender = true;
+
+    bool _running = false;
+    int _frameRate = 60;
+    FrameStats _frameStats;
+
+    bool _profiling = false;
+    Profile _profile;
+
+    /**
+     * Set while timing the outermost call, so re-entrant calls aren't counted twice
+     */
+    bool _profilingEvent = false;
+    bool _profilingFrame = false;
+    bool _profilingLayout = false;
+
+    double _eventTime = 0.0;
+    double _layoutTime = 0.0;
+
+    /**
+     * The time taken by the children of the widget being drawn
+     */
+    double _profileNestedTime = 0.0;
+
+    std::vector<std::weak_ptr<Widget>> _animatingWidgets;
+    std::shared_ptr<SDL_Texture> _frameTexture;
+
+    bool _drawBatching = false;
+    DrawList _drawList;
+
+    bool _pointerRouting = false;
+
+    /**
+     * The pointer position of the event being routed
+     */
+    SDL_FPoint _pointerPosition = {0, 0};
+
+    /**
+     * The widgets overlapping each cell of a uniform grid
+     */
+    std::unordered_map<Uint64, std::vector<Widget*>> _hitTestCells;
+
+    /**
+     * The range of cells, as x1, y1, x2, y2, each widget is in
+     */
+    std::unordered_map<Widget*, SDL_Rect> _hitTestWidgets;
+
+    /**
+     * The widgets that must be given the next pointer event even if
+     * the pointer is not over them
+     */
+    std::vector<std::weak_ptr<Widget>> _pointerWidgets;
+
+    /**
+     * The widgets in the window, including the sidebar, by name
+     */
+    std::unordered_map<std::string, std::vector<Widget*>> _nameIndex;
+
+    void _addAnimating(WidgetPtr widget);
+    void _addDamage(const SDL_Rect& rect);
+    void _addPointerWidget(WidgetPtr widget);
+
+    /**
+     * Takes a widget out of a range of hit-test cells
+     */
+    void _clearHitTestCells(Widget* widget, const SDL_Rect& cells);
+
+    bool _createFrameTexture();
+    void _damageAnimating();
+
+    /**
+     * Adds or moves a widget in the hit-test index
+     */
+    void _indexWidget(Widget* widget);
+
+    /**
+     * Returns true if a widget or the sidebar is animating
+     */
+    bool _isAnimating();
+
+    /**
+     * Returns true if the widget is in the tree of layer
+     */
+    bool _isInLayer(Widget* widget, Widget* layer);
+
+    /**
+     * Takes a widget and all of its children out of the hit-test index
+     */
+    void _removeHitTestCells(Widget* widget);
+
+    bool _routePointerEvent(const SDL_Event *event, Widget* layer);
+
+    /**
+     * Removes a widget and its children from the hit-test and name indexes
+     */
+    void _detachWidget(Widget* widget);
+
+    /**
+     * Finds the named widgets inside a container using the name index
+     * 
+     * \param ancestor the container to search in
+     * \param first if true only the first match in tree order is returned
+     * \param result the matches in tree order
+     */
+    void _findNamed(const Container* ancestor, const std::string& name, bool first, std::vector<WidgetPtr>& result);
+
+    void _indexName(Widget* widget);
+    void _unindexName(Widget* widget, const std::string& name);
     void _render(double deltaTime) override;
 
+    /**
+     * Draws a sliced texture as nine quads through the DrawList
+     */
+    void _renderTexture9Grid(const TextureData& data, const SDL_FRect& destRect, float scale, DrawList* drawList);
+
+    /**
+     * Draws a box where a texture that is still loading will be
+     */
+    void _renderPlaceholder(const SDL_FRect& destRect);
+
+    bool _addCursor(CursorType cursorType, SDL_Surface* surface, const SDL_Point& hotspot);
+    bool _addTexture(const std::string& textureName, SDL_Surface* surface, const TextureSlice& sliceInfo);
+
     std::map<std::string, std::shared_ptr<TextureData>> _textureCache;
+    std::set<std::string> _pendingTextures;
     std::map<CursorType, std::shared_ptr<SDL_Cursor>> _cursorCache;
   };
   using WindowPtr = std::shared_ptr<SGI::Window>;
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGI_MIX_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// Built for any x86 CPU and only used when SDL finds AVX2
+#define SGI_MIX_AVX2
+#define SGI_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON)
+#define SGI_MIX_NEON
+#include <arm_neon.h>
+#endif
+#include "mixkernel.h"
+
+namespace SGI {
+  // Samples below the knee pass unchanged. Above it the curve bends
+  // along a parabola that keeps the slope at the knee and reaches 1.0
+  // with a flat slope at twice the headroom past the knee.
+  static const float SOFT_CLIP_KNEE = 0.8f;
+  static const float SOFT_CLIP_HEADROOM = 1.0f - SOFT_CLIP_KNEE;
+  static const float SOFT_CLIP_SCALE = 1.0f / SOFT_CLIP_HEADROOM;
+
+  using MixFunction = void (*)(float*, const float*, int, float, float, float, float);
+  using SoftClipFunction = void (*)(float*, int);
+
+  struct Kernels {
+    const char* name;
+    MixFunction mix;
+    SoftClipFunction softClip;
+  };
+
+  static void mixScalar(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep)
+  {
+    for (int i = 0; i < frames; ++i) {
+      output[i * 2] += input[i * 2] * left;
+      output[i * 2 + 1] += input[i * 2 + 1] * right;
+      left += leftStep;
+      right += rightStep;
+    }
+  }
+
+  static void softClipScalar(float* buffer, int samples)
+  {
+    for (int i = 0; i < samples; ++i) {
+      float x = std::fabs(buffer[i]);
+      float over = std::min(std::max(x - SOFT_CLIP_KNEE, 0.0f) * SOFT_CLIP_SCALE, 2.0f);
+      float y = std::min(x, SOFT_CLIP_KNEE) + SOFT_CLIP_HEADROOM * (over - over * over * 0.25f);
+      buffer[i] = std::copysign(y, buffer[i]);
+    }
+  }
+
+#ifdef SGI_MIX_SSE2
+  static void mixSSE2(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep)
+  {
+    // Two frames at a time
+    __m128 gain = _mm_setr_ps(left, right, left + leftStep, right + rightStep);
+    __m128 step = _mm_setr_ps(leftStep * 2, rightStep * 2, leftStep * 2, rightStep * 2);
+    int i = 0;
+    for (; i + 2 <= frames; i += 2) {
+      __m128 in = _mm_loadu_ps(input + i * 2);
+      __m128 out = _mm_loadu_ps(output + i * 2);
+      _mm_storeu_ps(output + i * 2, _mm_add_ps(out, _mm_mul_ps(in, gain)));
+      gain = _mm_add_ps(gain, step);
+    }
+    mixScalar(output + i * 2, input + i * 2, frames - i, left + leftStep * i, right + rightStep * i, leftStep, rightStep);
+  }
+
+  static void softClipSSE2(float* buffer, int samples)
+  {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 knee = _mm_set1_ps(SOFT_CLIP_KNEE);
+    const __m128 headroom = _mm_set1_ps(SOFT_CLIP_HEADROOM);
+    const __m128 scale = _mm_set1_ps(SOFT_CLIP_SCALE);
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= samples; i += 4) {
+      __m128 in = _mm_loadu_ps(buffer + i);
+      __m128 x = _mm_andnot_ps(sign, in);
+      __m128 over = _mm_min_ps(_mm_mul_ps(_mm_max_ps(_mm_sub_ps(x, knee), zero), scale), two);
+      __m128 bend = _mm_sub_ps(over, _mm_mul_ps(_mm_mul_ps(over, over), quarter));
+      __m128 y = _mm_add_ps(_mm_min_ps(x, knee), _mm_mul_ps(headroom, bend));
+      _mm_storeu_ps(buffer + i, _mm_or_ps(y, _mm_and_ps(sign, in)));
+    }
+    softClipScalar(buffer + i, samples - i);
+  }
+#endif
+
+#ifdef SGI_MIX_AVX2
+  SGI_TARGET_AVX2 static void mixAVX2(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep)
+  {
+    // Four frames at a time
+    __m256 gain = _mm256_setr_ps(left, right, left + leftStep, right + rightStep,
+                                 left + leftStep * 2, right + rightStep * 2, left + leftStep * 3, right + rightStep * 3);
+    __m256 step = _mm256_setr_ps(leftStep * 4, rightStep * 4, leftStep * 4, rightStep * 4,
+                                 leftStep * 4, rightStep * 4, leftStep * 4, rightStep * 4);
+    int i = 0;
+    for (; i + 4 <= frames; i += 4) {
+      __m256 in = _mm256_loadu_ps(input + i * 2);
+      __m256 out = _mm256_loadu_ps(output + i * 2);
+      _mm256_storeu_ps(output + i * 2, _mm256_add_ps(out, _mm256_mul_ps(in, gain)));
+      gain = _mm256_add_ps(gain, step);
+    }
+    mixSSE2(output + i * 2, input + i * 2, frames - i, left + leftStep * i, right + rightStep * i, leftStep, rightStep);
+  }
+
+  SGI_TARGET_AVX2 static void softClipAVX2(float* buffer, int samples)
+  {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 knee = _mm256_set1_ps(SOFT_CLIP_KNEE);
+    const __m256 headroom = _mm256_set1_ps(SOFT_CLIP_HEADROOM);
+    const __m256 scale = _mm256_set1_ps(SOFT_CLIP_SCALE);
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= samples; i += 8) {
+      __m256 in = _mm256_loadu_ps(buffer + i);
+      __m256 x = _mm256_andnot_ps(sign, in);
+      __m256 over = _mm256_min_ps(_mm256_mul_ps(_mm256_max_ps(_mm256_sub_ps(x, knee), zero), scale), two);
+      __m256 bend = _mm256_sub_ps(over, _mm256_mul_ps(_mm256_mul_ps(over, over), quarter));
+      __m256 y = _mm256_add_ps(_mm256_min_ps(x, knee), _mm256_mul_ps(headroom, bend));
+      _mm256_storeu_ps(buffer + i, _mm256_or_ps(y, _mm256_and_ps(sign, in)));
+    }
+    softClipSSE2(buffer + i, samples - i);
+  }
+#endif
+
+#ifdef SGI_MIX_NEON
+  static void mixNEON(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep)
+  {
+    // Two frames at a time
+    const float start[4] = {left, right, left + leftStep, right + rightStep};
+    const float steps[4] = {leftStep * 2, rightStep * 2, leftStep * 2, rightStep * 2};
+    float32x4_t gain = vld1q_f32(start);
+    float32x4_t step = vld1q_f32(steps);
+    int i = 0;
+    for (; i + 2 <= frames; i += 2) {
+      float32x4_t in = vld1q_f32(input + i * 2);
+      float32x4_t out = vld1q_f32(output + i * 2);
+      vst1q_f32(output + i * 2, vmlaq_f32(out, in, gain));
+      gain = vaddq_f32(gain, step);
+    }
+    mixScalar(output + i * 2, input + i * 2, frames - i, left + leftStep * i, right + rightStep * i, leftStep, rightStep);
+  }
+
+  static void softClipNEON(float* buffer, int samples)
+  {
+    const uint32x4_t sign = vdupq_n_u32(0x80000000);
+    const float32x4_t knee = vdupq_n_f32(SOFT_CLIP_KNEE);
+    const float32x4_t headroom = vdupq_n_f32(SOFT_CLIP_HEADROOM);
+    const float32x4_t scale = vdupq_n_f32(SOFT_CLIP_SCALE);
+    const float32x4_t quarter = vdupq_n_f32(0.25f);
+    const float32x4_t two = vdupq_n_f32(2.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    int i = 0;
+    for (; i + 4 <= samples; i += 4) {
+      float32x4_t in = vld1q_f32(buffer + i);
+      float32x4_t x = vabsq_f32(in);
+      float32x4_t over = vminq_f32(vmulq_f32(vmaxq_f32(vsubq_f32(x, knee), zero), scale), two);
+      float32x4_t bend = vmlsq_f32(over, vmulq_f32(over, over), quarter);
+      float32x4_t y = vmlaq_f32(vminq_f32(x, knee), headroom, bend);
+      // The sign bit from the input, the rest from the curve
+      vst1q_f32(buffer + i, vbslq_f32(sign, in, y));
+    }
+    softClipScalar(buffer + i, samples - i);
+  }
+#endif
+
+  static const Kernels SCALAR = {"scalar", mixScalar, softClipScalar};
+#ifdef SGI_MIX_SSE2
+  static const Kernels SSE2 = {"SSE2", mixSSE2, softClipSSE2};
+#endif
+#ifdef SGI_MIX_AVX2
+  static const Kernels AVX2 = {"AVX2", mixAVX2, softClipAVX2};
+#endif
+#ifdef SGI_MIX_NEON
+  static const Kernels NEON = {"NEON", mixNEON, softClipNEON};
+#endif
+
+  /**
+   * Returns the kernels the CPU can run, best first
+   */
+  static const std::vector<const Kernels*>& getAvailable()
+  {
+    static const std::vector<const Kernels*> available = []() {
+      std::vector<const Kernels*> kernels;
+#ifdef SGI_MIX_AVX2
+      if (SDL_HasAVX2()) {
+        kernels.push_back(&AVX2);
+      }
+#endif
+#ifdef SGI_MIX_SSE2
+      kernels.push_back(&SSE2);
+#endif
+#ifdef SGI_MIX_NEON
+      kernels.push_back(&NEON);
+#endif
+      kernels.push_back(&SCALAR);
+      return kernels;
+    }();
+    return available;
+  }
+
+  static std::atomic<const Kernels*> current { nullptr };
+
+  static const Kernels& getKernels()
+  {
+    const Kernels* kernels = current.load(std::memory_order_acquire);
+    if (!kernels) {
+      kernels = getAvailable().front();
+      current.store(kernels, std::memory_order_release);
+    }
+    return *kernels;
+  }
+
+  const char* MixKernel::getName()
+  {
+    return getKernels().name;
+  }
+
+  std::vector<std::string> MixKernel::getNames()
+  {
+    std::vector<std::string> names;
+    for (const Kernels* kernels : getAvailable()) {
+      names.push_back(kernels->name);
+    }
+    return names;
+  }
+
+  void MixKernel::mix(float* output, const float* input, int frames, float left, float right, float leftStep, float rightStep)
+  {
+    getKernels().mix(output, input, frames, left, right, leftStep, rightStep);
+  }
+
+  bool MixKernel::select(const std::string& name)
+  {
+    for (const Kernels* kernels : getAvailable()) {
+      if (name == kernels->name) {
+        current.store(kernels, std::memory_order_release);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void MixKernel::softClip(float* buffer, int samples)
+  {
+    getKernels().softClip(buffer, samples);
+  }
+}
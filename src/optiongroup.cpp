@@ -18,29 +18,22 @@ namespace SGI {
     return widget;
   }
 
-  std::string OptionGroup::addChangeListener(const OptionGroupCallback& handler)
+  Uint64 OptionGroup::addChangeListener(const OptionGroupCallback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_changeHandelers.find(id) != _changeHandelers.end());
-    _changeHandelers[id] = handler;
-
-    return id;
+    return _changeListeners.add(handler);
   }
 
-  void OptionGroup::removeChangeListener(const std::string& id)
+  void OptionGroup::removeChangeListener(Uint64 handle)
   {
-    _changeHandelers.erase(id);
+    _changeListeners.remove(handle);
   }
 
   void OptionGroup::addChild(FlatOptionPtr option)
   {
-    _functionIds[option->getUUID()] = option->addChangeListener([this](WindowPtr window, WidgetPtr widget)->bool {
+    _functionIds[option->getId()] = option->addChangeListener([this](WindowPtr window, WidgetPtr widget)->bool {
       if (!_multiSelect) {
         for (const auto& child : _children) {
-          if (child->getUUID() == widget->getUUID()) {
+          if (child->getId() == widget->getId()) {
             continue;
           }
 
@@ -59,9 +52,7 @@ namespace SGI {
         }
       }
 
-      for (const auto& [id, handler] : _changeHandelers) {
-        handler(_root, selected);
-      }
+      _changeListeners.call(_root, selected);
       return false;
     });
     Container::addChild(option);
@@ -71,7 +62,7 @@ namespace SGI {
   {
     auto it = std::find(_children.begin(), _children.end(), option);
     if (it != _children.end()) {
-      option->removeChangeListener(_functionIds[option->getUUID()]);
+      option->removeChangeListener(_functionIds[option->getId()]);
     } 
 
     Container::removeChild(option);
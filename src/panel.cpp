@@ -19,6 +19,7 @@ namespace SGI {
   void Panel::setBackgroundTexture(const std::string textureName)
   {
     _backgroundTexture = textureName;
+    _invalidate();
   }
 
   void Panel::_render(double deltaTime)
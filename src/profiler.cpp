@@ -0,0 +1,54 @@
+#include <SDL3/SDL.h>
+#include "debug.h"
+#include "profiler.h"
+
+namespace SGI {
+  size_t Profiler::_textureBytes = 0;
+  size_t Profiler::_textureCount = 0;
+
+  size_t Profiler::getTextureBytes()
+  {
+    return _textureBytes;
+  }
+
+  size_t Profiler::getTextureCount()
+  {
+    return _textureCount;
+  }
+
+  double Profiler::milliseconds()
+  {
+    static const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    return SDL_GetPerformanceCounter() * 1000.0 / frequency;
+  }
+
+  SDL_Texture* Profiler::trackTexture(SDL_Texture* texture)
+  {
+    if (texture == nullptr) {
+      return nullptr;
+    }
+
+    SDL_PropertiesID properties = SDL_GetTextureProperties(texture);
+    Sint64 width = SDL_GetNumberProperty(properties, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0);
+    Sint64 height = SDL_GetNumberProperty(properties, SDL_PROP_TEXTURE_HEIGHT_NUMBER, 0);
+    Sint64 format = SDL_GetNumberProperty(properties, SDL_PROP_TEXTURE_FORMAT_NUMBER, SDL_PIXELFORMAT_RGBA32);
+    size_t bytes = static_cast<size_t>(width * height * SDL_BYTESPERPIXEL(static_cast<SDL_PixelFormat>(format)));
+
+    _textureBytes += bytes;
+    _textureCount++;
+
+    // The property is cleaned up when SDL destroys the texture, so no
+    // call sites have to be changed to count the release. SDL also
+    // cleans it up straight away if it can't be set.
+    if (!SDL_SetPointerPropertyWithCleanup(properties, "SGI.profiler.bytes", reinterpret_cast<void*>(bytes), _releaseTexture, nullptr)) {
+      ERROR(PROFILER, "Unable to track texture: %s", SDL_GetError());
+    }
+    return texture;
+  }
+
+  void Profiler::_releaseTexture(void* userdata, void* value)
+  {
+    _textureBytes -= reinterpret_cast<size_t>(value);
+    _textureCount--;
+  }
+}
@@ -7,48 +7,28 @@
 #include <sstream>
 #include <string>
 #include "debug.h"
+#include "drawlist.h"
+#include "profiler.h"
+#include "theme.h"
 #include "window.h"
 
 namespace SGI {
-  Widget::Widget() : _renderer(nullptr),  _root(nullptr), _self(nullptr), _focused(false), _mouseOver(false), _name("")
-  {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<uint32_t> dis(0, 0xFFFFFFFF);
-
-    uint32_t part1 = dis(gen);
-    uint32_t part2 = dis(gen);
-    uint32_t part3 = dis(gen);
-    uint32_t part4 = dis(gen);
-
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    ss << std::setw(8) << part1 << "-";
-    ss << std::setw(4) << ((part2 >> 16) & 0xFFFF) << "-";
-    ss << std::setw(4) << (((part2 >> 12) & 0x0FFF) | 0x4000) << "-"; // 4xxx
-    ss << std::setw(4) << (((part3 >> 16) & 0x3FFF) | 0x8000) << "-"; // 8xxx
-    ss << std::setw(4) << (part3 & 0xFFFF);
-    ss << std::setw(8) << part4;
+  std::atomic<Uint64> Widget::_nextId(1);
+  const SDL_Color Widget::TINT_WHITE = {255, 255, 255, 255};
 
-    _uuid = ss.str();
+  Widget::Widget() : _root(nullptr), _self(nullptr), _focused(false), _theme(Themes::getDefault()), _mouseOver(false), _name(""), _renderer(nullptr), _id(_nextId++)
+  {
   }
 
   // Overload the equality operator
   bool operator==(const Widget& lhs, const Widget& rhs)
   {
-    return lhs._uuid == rhs._uuid;    
+    return lhs._id == rhs._id;
   }
 
-  std::string Widget::addMouseListener(const MouseEventType type, const MouseButtonCallback& handler)
+  Uint64 Widget::addMouseListener(const MouseEventType type, const MouseButtonCallback& handler)
   {
-    std::string id;
-    
-    do {
-      id = _generateShortCode();
-    } while (_mouseHandlers[type].find(id) != _mouseHandlers[type].end());
-    _mouseHandlers[type][id] = handler;
-
-    return id;
+    return _mouseListeners[type].add(handler);
   }
 
   SDL_Rect Widget::getBounds()
@@ -61,13 +41,46 @@ namespace SGI {
     return _contentArea;
   }
 
+  Uint64 Widget::getId()
+  {
+    return _id;
+  }
+
   std::string Widget::getName()
   {
     return _name;
   }
 
+  Widget::RenderProfile Widget::getRenderProfile()
+  {
+    return _renderProfile;
+  }
+
   std::string Widget::getUUID()
   {
+    if (!_uuid.empty()) {
+      return _uuid;
+    }
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<uint32_t> dis(0, 0xFFFFFFFF);
+
+    uint32_t part1 = dis(gen);
+    uint32_t part2 = dis(gen);
+    uint32_t part3 = dis(gen);
+    uint32_t part4 = dis(gen);
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    ss << std::setw(8) << part1 << "-";
+    ss << std::setw(4) << ((part2 >> 16) & 0xFFFF) << "-";
+    ss << std::setw(4) << (((part2 >> 12) & 0x0FFF) | 0x4000) << "-"; // 4xxx
+    ss << std::setw(4) << (((part3 >> 16) & 0x3FFF) | 0x8000) << "-"; // 8xxx
+    ss << std::setw(4) << (part3 & 0xFFFF);
+    ss << std::setw(8) << part4;
+
+    _uuid = ss.str();
     return _uuid;
   }
 
@@ -101,10 +114,9 @@ namespace SGI {
         _checkMouseInBounds();
         if (_mouseOver == true) {
           _mouseButtonState[event->button.button] = true;
-          for (const auto& [id, handler] : _mouseHandlers[MouseEventType::Down]) {
-            if (handler(_root, _self, event->button.button)) {
-              stop = true;
-            }
+          _invalidate();
+          if (_mouseListeners[MouseEventType::Down].call(_root, _self, event->button.button)) {
+            stop = true;
           }
         }
         break;
@@ -113,19 +125,18 @@ namespace SGI {
       case SDL_EVENT_MOUSE_BUTTON_UP: {
         _checkMouseInBounds();
         if (_mouseOver == true) {
-          for (const auto& [id, handler] : _mouseHandlers[MouseEventType::Up]) {
-            if (handler(_root, _self, event->button.button)) {
-              stop = true;
-            }
+          if (_mouseListeners[MouseEventType::Up].call(_root, _self, event->button.button)) {
+            stop = true;
           }
           if (_mouseButtonState[event->button.button] == true) {
-            for (const auto& [id, handler] : _mouseHandlers[MouseEventType::Click]) {
-              if (handler(_root, _self, event->button.button)) {
-                stop = true;
-              }
+            if (_mouseListeners[MouseEventType::Click].call(_root, _self, event->button.button)) {
+              stop = true;
             }
           }
         }
+        if (_mouseButtonState[event->button.button] == true) {
+          _invalidate();
+        }
         _mouseButtonState[event->button.button] = false;
         break;
       }
@@ -134,12 +145,9 @@ namespace SGI {
     return stop;
   }
 
-  void Widget::removeMouseListener(const MouseEventType type, const std::string& id)
+  void Widget::removeMouseListener(const MouseEventType type, Uint64 handle)
   {
-    auto it = _mouseHandlers[type].find(id);
-    if (it != _mouseHandlers[type].end()) {
-        _mouseHandlers[type].erase(it);
-    }
+    _mouseListeners[type].remove(handle);
   }
 
   void Widget::setConstraint(ConstraintType constraint, int minValue, int maxValue)
@@ -187,7 +195,13 @@ namespace SGI {
 
   void Widget::setName(std::string name)
   {
+    if (_root) {
+      _root->_unindexName(this, _name);
+    }
     _name = name;
+    if (_root) {
+      _root->_indexName(this);
+    }
   }
 
   void Widget::setPadding(unsigned int left, unsigned int right, unsigned int top, unsigned int bottom)
@@ -197,6 +211,62 @@ namespace SGI {
     _padding.top = top;
     _padding.bottom = bottom;
     _updateContentArea();
+    _invalidate();
+  }
+
+  void Widget::_drawProfiled(double deltaTime)
+  {
+    if (!_root || !_root->_profiling) {
+      _draw(deltaTime);
+      return;
+    }
+
+    // Children drawn inside _draw add their time to _profileNestedTime,
+    // which is taken off so each widget is only charged for itself
+    double nestedTime = _root->_profileNestedTime;
+    _root->_profileNestedTime = 0.0;
+
+    double start = Profiler::milliseconds();
+    _draw(deltaTime);
+    double elapsed = Profiler::milliseconds() - start;
+
+    double selfTime = elapsed - _root->_profileNestedTime;
+    _root->_profileNestedTime = nestedTime + elapsed;
+
+    _renderProfile.frames++;
+    _renderProfile.lastTime = selfTime;
+    _renderProfile.totalTime += selfTime;
+    if (selfTime > _renderProfile.maxTime) {
+      _renderProfile.maxTime = selfTime;
+    }
+  }
+
+  void Widget::_fillRect(const SDL_FRect& rect, SDL_Color color)
+  {
+    DrawList* drawList = DrawList::get(_renderer.get());
+    if (drawList) {
+      drawList->fillRect(rect, color);
+      return;
+    }
+
+    SDL_SetRenderDrawColor(_renderer.get(), color.r, color.g, color.b, color.a);
+    SDL_RenderFillRect(_renderer.get(), &rect);
+  }
+
+  void Widget::_invalidate()
+  {
+    _invalidate(_bounds);
+  }
+
+  void Widget::_invalidate(const SDL_Rect& rect)
+  {
+    for (Container* parent = _parent; parent != nullptr; parent = parent->_parent) {
+      parent->_cacheValid = false;
+    }
+
+    if (_root) {
+      _root->_addDamage(rect);
+    }
   }
 
   void Widget::_render(double deltaTime)
@@ -214,18 +284,91 @@ namespace SGI {
     // SDL_RenderRect(getRenderer().get(), &rect);
   };
 
+  void Widget::_renderTexture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination)
+  {
+    DrawList* drawList = DrawList::get(_renderer.get());
+    if (drawList) {
+      drawList->texture(texture, source, destination);
+      return;
+    }
+
+    SDL_RenderTexture(_renderer.get(), texture, source, &destination);
+  }
+
+  void Widget::_renderTexture(SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& destination, SDL_Color color)
+  {
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+    _renderTexture(texture, source, destination);
+  }
+
+  void Widget::_setAnimating(bool value)
+  {
+    _animating = value;
+    if (_animating && _root && _self) {
+      _root->_addAnimating(_self);
+    }
+  }
+
   void Widget::_setBounds(SDL_Rect& bounds)
   {
+    bool changed = _bounds.x != bounds.x || _bounds.y != bounds.y || _bounds.w != bounds.w || _bounds.h != bounds.h;
+    if (changed) {
+      _invalidate();
+    }
+
     _bounds.x = bounds.x;
     _bounds.y = bounds.y;
     _bounds.w = bounds.w;
     _bounds.h = bounds.h;
     _updateContentArea();
+
+    if (changed) {
+      _invalidate();
+      if (_root) {
+        _root->_indexWidget(this);
+      }
+    }
+  }
+
+  void Widget::_setClipRect(const SDL_Rect* rect)
+  {
+    SDL_Rect clip;
+    if (_root && _root->_damageActive) {
+      clip = _root->_damageRect;
+      if (rect && !SDL_GetRectIntersection(rect, &_root->_damageRect, &clip)) {
+        clip = SDL_Rect{0, 0, 0, 0};
+      }
+      rect = &clip;
+    }
+
+    DrawList* drawList = DrawList::get(_renderer.get());
+    if (drawList) {
+      drawList->setClip(rect);
+      return;
+    }
+
+    SDL_SetRenderClipRect(_renderer.get(), rect);
+  }
+
+  void Widget::_setPointerCapture(bool value)
+  {
+    _pointerCapture = value;
+    if (_pointerCapture && _root && _self) {
+      _root->_addPointerWidget(_self);
+    }
   }
 
   void Widget::_setRoot(std::shared_ptr<SGI::Window> root)
   {
     _root = root;
+    if (_animating && _root && _self) {
+      _root->_addAnimating(_self);
+    }
+    if (_root) {
+      _root->_indexWidget(this);
+      _root->_indexName(this);
+    }
   }
 
   void Widget::_setRenderer(std::shared_ptr<SDL_Renderer> renderer)
@@ -233,48 +376,37 @@ namespace SGI {
     _renderer = renderer;
   }
 
+  void Widget::_setTheme(const Theme* theme)
+  {
+    _theme = theme;
+    _invalidate();
+  }
+
   void Widget::_checkMouseInBounds()
   {
     float mouseX, mouseY;
-    SDL_GetMouseState(&mouseX, &mouseY);
+    if (_root && _root->_pointerRouting) {
+      mouseX = _root->_pointerPosition.x;
+      mouseY = _root->_pointerPosition.y;
+    } else {
+      SDL_GetMouseState(&mouseX, &mouseY);
+    }
     if (mouseX > _bounds.x && mouseX < _bounds.x + _bounds.w &&
         mouseY > _bounds.y && mouseY < _bounds.y + _bounds.h) {
-      _mouseOver = true;
-      for (const auto& [id, handler] : _mouseHandlers[MouseEventType::Enter]) {
-        handler(_root, _self, 0);
+      if (_mouseOver == false) {
+        _invalidate();
       }
+      _mouseOver = true;
+      _mouseListeners[MouseEventType::Enter].call(_root, _self, 0);
     } else {
       if (_mouseOver == true) {
-        for (const auto& [id, handler] : _mouseHandlers[MouseEventType::Exit]) {
-          handler(_root, _self, 0);
-        }
+        _invalidate();
+        _mouseListeners[MouseEventType::Exit].call(_root, _self, 0);
       }
       _mouseOver = false;
     }
   }
 
-  std::string Widget::_generateShortCode()
-  {
-    const char characters[] =
-        "0123456789"
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz";
-    const size_t charactersCount = sizeof(characters) - 1;
-    const size_t codeLength = 6;
-
-    std::string shortCode;
-    shortCode.reserve(codeLength);
-
-    std::random_device rd;
-    std::uniform_int_distribution<> distribution(0, charactersCount - 1);
-
-    for (size_t i = 0; i < codeLength; ++i) {
-        shortCode += characters[distribution(rd)];
-    }
-
-    return shortCode;
-  }
-
   void Widget::_updateContentArea()
   {
     _contentArea.x = _bounds.x + _padding.left;
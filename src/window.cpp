@@ -1,11 +1,163 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <nlohmann/json.hpp>
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
+#include "assetloader.h"
+#include "audioplayer.h"
+#include "bundle.h"
 #include "debug.h"
+#include "fontbook.h"
+#include "profiler.h"
 #include "window.h"
 
+using json = nlohmann::json;
+
 namespace SGI {
+  static const char* DEBUG_FONT = "default";
+  static const int DEBUG_FONT_SIZE = 14;
+  static const size_t DEBUG_WIDGET_COUNT = 5;
+
+  static const int HIT_TEST_CELL_SIZE = 64;
+
+  // Milliseconds run spends uploading assets each frame
+  static const double ASSET_UPLOAD_BUDGET = 4.0;
+  static const SDL_Color PLACEHOLDER_COLOR = {128, 128, 128, 64};
+
+  /**
+   * An image decoded by an AssetLoader worker, freed if it is never uploaded
+   */
+  struct DecodedImage {
+    SDL_Surface* surface = nullptr;
+
+    ~DecodedImage()
+    {
+      if (surface) {
+        SDL_DestroySurface(surface);
+      }
+    }
+  };
+
+  static int hitTestCell(int value)
+  {
+    // Round toward negative infinity so cells left of and above the origin don't overlap
+    return value >= 0 ? value / HIT_TEST_CELL_SIZE : (value - HIT_TEST_CELL_SIZE + 1) / HIT_TEST_CELL_SIZE;
+  }
+
+  static Uint64 hitTestKey(int cellX, int cellY)
+  {
+    return (static_cast<Uint64>(static_cast<Uint32>(cellX)) << 32) | static_cast<Uint32>(cellY);
+  }
+
+  static bool isSliced(const Window::TextureSlice& slice)
+  {
+    return slice.x1 != 0 || slice.x2 != 0 || slice.y1 != 0 || slice.y2 != 0;
+  }
+
+  struct AtlasPage {
+    int width = 0;
+    int height = 0;
+    int shelfX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+  };
+
+  /**
+   * Packs rects onto shelves in pages, tallest first
+   * 
+   * Each rect gets padding on every side. Rects too big for a page get
+   * a page of their own.
+   * 
+   * \param rects the sizes to pack, their x and y are set to where they go
+   * \param pages the used size of each page
+   * \returns the page of each rect
+   */
+  static std::vector<int> packAtlas(std::vector<SDL_Rect>& rects, int pageSize, int padding, std::vector<AtlasPage>& pages)
+  {
+    std::vector<size_t> order(rects.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      if (rects[a].h != rects[b].h) {
+        return rects[a].h > rects[b].h;
+      }
+      return rects[a].w > rects[b].w;
+    });
+
+    std::vector<int> result(rects.size(), -1);
+    for (size_t i : order) {
+      SDL_Rect& rect = rects[i];
+      int width = rect.w + padding * 2;
+      int height = rect.h + padding * 2;
+
+      if (width > pageSize || height > pageSize) {
+        AtlasPage page;
+        page.width = width;
+        page.height = height;
+        page.shelfX = pageSize;
+        page.shelfY = pageSize;
+        pages.push_back(page);
+        rect.x = padding;
+        rect.y = padding;
+        result[i] = pages.size() - 1;
+        continue;
+      }
+
+      for (size_t p = 0; p <= pages.size() && result[i] < 0; ++p) {
+        if (p == pages.size()) {
+          pages.push_back(AtlasPage());
+        }
+        AtlasPage& page = pages[p];
+
+        if (page.shelfX + width > pageSize || height > page.shelfHeight) {
+          // Start a new shelf below the current one
+          if (page.shelfY + page.shelfHeight + height > pageSize) {
+            continue;
+          }
+          page.shelfY += page.shelfHeight;
+          page.shelfX = 0;
+          page.shelfHeight = height;
+        }
+
+        rect.x = page.shelfX + padding;
+        rect.y = page.shelfY + padding;
+        page.shelfX += width;
+        page.width = std::max(page.width, page.shelfX);
+        page.height = std::max(page.height, page.shelfY + height);
+        result[i] = p;
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * Fills the padding around an image with copies of its edge pixels
+   * 
+   * Keeps neighbouring images from bleeding in when a page is drawn
+   * with linear filtering.
+   */
+  static void extrudeAtlasImage(SDL_Surface* page, const SDL_Rect& rect, int padding)
+  {
+    Uint32* pixels = static_cast<Uint32*>(page->pixels);
+    int pitch = page->pitch / sizeof(Uint32);
+    for (int y = rect.y - padding; y < rect.y + rect.h + padding; ++y) {
+      int sourceY = std::clamp(y, rect.y, rect.y + rect.h - 1);
+      for (int x = rect.x - padding; x < rect.x + rect.w + padding; ++x) {
+        if (x >= rect.x && x < rect.x + rect.w && y == sourceY) {
+          x = rect.x + rect.w - 1;
+          continue;
+        }
+        int sourceX = std::clamp(x, rect.x, rect.x + rect.w - 1);
+        pixels[y * pitch + x] = pixels[sourceY * pitch + sourceX];
+      }
+    }
+  }
+
   std::shared_ptr<Window> Window::create(const std::string& title, int width, int height)
   {
     std::shared_ptr<Window> widget = std::make_shared<Window>(Window(title, width, height));
@@ -48,6 +200,7 @@ namespace SGI {
       ERROR(App, "SDL_CreateRenderer Error: %s", SDL_GetError());
     }
     std::shared_ptr<SDL_Renderer> renderer = std::shared_ptr<SDL_Renderer>(rendererPtr, [](SDL_Renderer* p) {
+      FontBook::releaseRenderer(p);
       LOG(MEMORY, "SDL_Renderer has been freed");
       SDL_DestroyRenderer(p);
     });
@@ -78,62 +231,226 @@ namespace SGI {
 
   bool Window::addCursor(CursorType cursorType, const std::string& fileName, const SDL_Point& hotspot) {
     std::string fullPath = _resourcePath + fileName;
-    SDL_Surface* surface = IMG_Load(fullPath.c_str());
-
-    SDL_Cursor* cursor = SDL_CreateColorCursor(surface, hotspot.x, hotspot.y);
-    if (!cursor) {
-      SDL_DestroySurface(surface);
-      ERROR(WINDOW, "Cursor not created: %s", SDL_GetError());
+    SDL_Surface* surface = IMG_Load_IO(Bundle::openResource(_resourcePath, fileName), true);
+    if (!surface) {
+      ERROR(WINDOW, "Unable to load cursor %s: %s", fullPath.c_str(), SDL_GetError());
       return false;
     }
+
+    bool result = _addCursor(cursorType, surface, hotspot);
     SDL_DestroySurface(surface);
+    return result;
+  }
 
-    auto cursorPtr = std::shared_ptr<SDL_Cursor>(cursor, [](SDL_Cursor* p) {
-      if (p) {
-        LOG(MEMORY, "SDL_Cursor has been freed");
-        SDL_DestroyCursor(p);
+  AssetPtr Window::addCursorAsync(CursorType cursorType, const std::string& fileName, const SDL_Point& hotspot, const AssetLoader::Callback& callback)
+  {
+    std::string resourcePath = _resourcePath;
+    std::string fullPath = _resourcePath + fileName;
+    std::weak_ptr<Widget> self = _self;
+    auto image = std::make_shared<DecodedImage>();
+
+    return AssetLoader::load([resourcePath, fileName, image]() {
+      image->surface = IMG_Load_IO(Bundle::openResource(resourcePath, fileName), true);
+      return image->surface != nullptr;
+    }, [self, cursorType, hotspot, image]() {
+      auto window = std::static_pointer_cast<Window>(self.lock());
+      return window && window->_addCursor(cursorType, image->surface, hotspot);
+    }, [fullPath, callback](bool success) {
+      if (!success) {
+        ERROR(WINDOW, "Unable to load cursor %s", fullPath.c_str());
+      }
+      if (callback) {
+        callback(success);
       }
     });
+  }
 
-    _cursorCache[cursorType] = cursorPtr;
+  bool Window::addAtlas(const std::string& fileName)
+  {
+    struct AtlasImage {
+      std::string name;
+      std::string fileName;
+      TextureSlice sliceInfo;
+      SDL_Surface* surface;
+    };
 
-    return true;
+    std::string fullPath = _resourcePath + fileName;
+    size_t size = 0;
+    char* text = static_cast<char*>(SDL_LoadFile_IO(Bundle::openResource(_resourcePath, fileName), &size, true));
+    if (!text) {
+      LOG(TEXTURE, "Unable to load atlas %s: %s", fullPath.c_str(), SDL_GetError());
+      return false;
+    }
+
+    std::vector<AtlasImage> images;
+    int pageSize = 1024;
+    int padding = 1;
+    try {
+      json atlas = json::parse(text, text + size);
+      pageSize = atlas.value("pageSize", pageSize);
+      padding = atlas.value("padding", padding);
+      for (const json& entry : atlas["images"]) {
+        AtlasImage image = {entry["name"].get<std::string>(), entry["file"].get<std::string>(), {0, 0, 0, 0}, nullptr};
+        if (entry.contains("slice")) {
+          const json& slice = entry["slice"];
+          image.sliceInfo = {slice[0].get<int>(), slice[1].get<int>(), slice[2].get<int>(), slice[3].get<int>()};
+        }
+        images.push_back(image);
+      }
+    } catch (const std::exception& e) {
+      ERROR(TEXTURE, "Unable to parse atlas %s: %s", fullPath.c_str(), e.what());
+      SDL_free(text);
+      return false;
+    }
+    SDL_free(text);
+
+    bool result = true;
+    std::vector<SDL_Rect> rects;
+    for (auto it = images.begin(); it != images.end();) {
+      std::string imagePath = _resourcePath + it->fileName;
+      SDL_Surface* surface = IMG_Load_IO(Bundle::openResource(_resourcePath, it->fileName), true);
+      if (surface) {
+        it->surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(surface);
+      }
+      if (!it->surface) {
+        LOG(TEXTURE, "Unable to load image %s: %s", imagePath.c_str(), SDL_GetError());
+        it = images.erase(it);
+        result = false;
+        continue;
+      }
+      SDL_SetSurfaceBlendMode(it->surface, SDL_BLENDMODE_NONE);
+      rects.push_back({0, 0, it->surface->w, it->surface->h});
+      ++it;
+    }
+
+    std::vector<AtlasPage> pages;
+    std::vector<int> imagePages = packAtlas(rects, pageSize, padding, pages);
+
+    std::vector<std::shared_ptr<SDL_Texture>> pageTextures;
+    for (size_t p = 0; p < pages.size(); ++p) {
+      SDL_Surface* pageSurface = SDL_CreateSurface(pages[p].width, pages[p].height, SDL_PIXELFORMAT_RGBA32);
+      if (!pageSurface) {
+        ERROR(TEXTURE, "Unable to create atlas page: %s", SDL_GetError());
+        pageTextures.push_back(nullptr);
+        continue;
+      }
+
+      for (size_t i = 0; i < images.size(); ++i) {
+        if (imagePages[i] == static_cast<int>(p)) {
+          SDL_BlitSurface(images[i].surface, nullptr, pageSurface, &rects[i]);
+          extrudeAtlasImage(pageSurface, rects[i], padding);
+        }
+      }
+
+      SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), pageSurface));
+      SDL_DestroySurface(pageSurface);
+      if (!texture) {
+        ERROR(TEXTURE, "Unable to create atlas page texture: %s", SDL_GetError());
+        pageTextures.push_back(nullptr);
+        continue;
+      }
+
+      pageTextures.push_back(std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
+        if (p) {
+          LOG(MEMORY, "SDL_Texture has been freed");
+          SDL_DestroyTexture(p);
+        }
+      }));
+      LOG(TEXTURE, "Atlas page %zu is %dx%d", p, pages[p].width, pages[p].height);
+    }
+
+    for (size_t i = 0; i < images.size(); ++i) {
+      const AtlasImage& image = images[i];
+      std::shared_ptr<SDL_Texture> texture = pageTextures[imagePages[i]];
+      if (texture) {
+        _textureCache[image.name] = std::make_shared<TextureData>(TextureData{
+          texture,
+          image.surface->w,
+          image.surface->h,
+          isSliced(image.sliceInfo),
+          image.sliceInfo,
+          {(float)rects[i].x, (float)rects[i].y, (float)rects[i].w, (float)rects[i].h}
+        });
+        LOG(TEXTURE, "Texture %s added to atlas page %d", image.name.c_str(), imagePages[i]);
+      } else {
+        result = false;
+      }
+      SDL_DestroySurface(image.surface);
+    }
+
+    return result;
   }
 
   bool Window::addTexture(const std::string& textureName, const std::string& fileName, const TextureSlice& sliceInfo)
   {
     std::string fullPath = _resourcePath + fileName;
-    SDL_Surface* surface = IMG_Load(fullPath.c_str());
+    SDL_Surface* surface = IMG_Load_IO(Bundle::openResource(_resourcePath, fileName), true);
 
     if (!surface) {
       LOG(TEXTURE, "Unable to load image %s: %s", fullPath.c_str(), SDL_GetError());
       return false;
     }
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(getRenderer().get(), surface);
+    bool result = _addTexture(textureName, surface, sliceInfo);
+    SDL_DestroySurface(surface);
+    return result;
+  }
 
-    if (!texture) {
-      LOG(TEXTURE, "Unable to create texture from %s: %s", fullPath.c_str(), SDL_GetError());
-      return false;
-    }
+  AssetPtr Window::addTextureAsync(const std::string& textureName, const std::string& fileName, const TextureSlice& sliceInfo, const AssetLoader::Callback& callback)
+  {
+    std::string resourcePath = _resourcePath;
+    std::string fullPath = _resourcePath + fileName;
+    std::weak_ptr<Widget> self = _self;
+    auto image = std::make_shared<DecodedImage>();
 
-    auto textureData = std::make_shared<TextureData>(TextureData{
-      std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
-        if (p) {
-          LOG(MEMORY, "SDL_Texture has been freed");
-          SDL_DestroyTexture(p);
-        }
-      }),
-      surface->w,
-      surface->h,
-      sliceInfo.x1 == 0 && sliceInfo.x2 == 0 && sliceInfo.y1 == 0 && sliceInfo.y1 == 0 ? false : true,
-      sliceInfo
+    _pendingTextures.insert(textureName);
+    return AssetLoader::load([resourcePath, fileName, image]() {
+      image->surface = IMG_Load_IO(Bundle::openResource(resourcePath, fileName), true);
+      return image->surface != nullptr;
+    }, [self, textureName, sliceInfo, image]() {
+      auto window = std::static_pointer_cast<Window>(self.lock());
+      return window && window->_addTexture(textureName, image->surface, sliceInfo);
+    }, [self, textureName, fullPath, callback](bool success) {
+      if (auto window = std::static_pointer_cast<Window>(self.lock())) {
+        window->_pendingTextures.erase(textureName);
+        // Replace the placeholder
+        window->_invalidate();
+      }
+      if (!success) {
+        LOG(TEXTURE, "Unable to load image %s", fullPath.c_str());
+      }
+      if (callback) {
+        callback(success);
+      }
     });
-    SDL_DestroySurface(surface);
+  }
 
-    _textureCache[textureName] = textureData;
-    LOG(TEXTURE, "Texture %s added", textureName.c_str());
-    return true;
+  DrawList::Stats Window::getDrawStats()
+  {
+    return _drawList.getStats();
+  }
+
+  Window::FrameStats Window::getFrameStats()
+  {
+    FrameStats stats = _frameStats;
+    if (stats.frames > 0) {
+      stats.frameTime = stats.busyTime / stats.frames;
+    }
+    if (stats.busyTime + stats.idleTime > 0) {
+      stats.load = stats.busyTime / (stats.busyTime + stats.idleTime);
+    }
+    return stats;
+  }
+
+  int Window::getFrameRate()
+  {
+    return _frameRate;
+  }
+
+  Window::Profile Window::getProfile()
+  {
+    return _profile;
   }
 
   ContainerPtr Window::getSidebar()
@@ -141,6 +458,36 @@ namespace SGI {
     return _sidebarContainer;
   }
 
+  std::vector<WidgetPtr> Window::getSlowestWidgets(size_t count)
+  {
+    std::vector<WidgetPtr> widgets;
+    std::function<void(const WidgetPtr&)> collect = [&](const WidgetPtr& widget) {
+      if (widget->_renderProfile.frames > 0) {
+        widgets.push_back(widget);
+      }
+      if (ContainerPtr container = std::dynamic_pointer_cast<Container>(widget)) {
+        for (const auto& child : container->_children) {
+          collect(child);
+        }
+      }
+    };
+    for (const auto& child : _children) {
+      collect(child);
+    }
+    collect(_sidebarContainer);
+
+    auto averageTime = [](const WidgetPtr& widget) {
+      return widget->_renderProfile.totalTime / widget->_renderProfile.frames;
+    };
+
+    count = std::min(count, widgets.size());
+    std::partial_sort(widgets.begin(), widgets.begin() + count, widgets.end(), [&](const WidgetPtr& a, const WidgetPtr& b) {
+      return averageTime(a) > averageTime(b);
+    });
+    widgets.resize(count);
+    return widgets;
+  }
+
   std::shared_ptr<Window::TextureData> Window::getTexture(const std::string& textureName)
   {
     auto textureIt = _textureCache.find(textureName);
@@ -159,6 +506,7 @@ namespace SGI {
   {
     if (_sidebarState == SidebarState::CLOSED) {
       _sidebarState = SidebarState::LEFT_OPENING;
+      _invalidate();
       LOG(WINDOW, "Sidebar opening");
     }
   }
@@ -167,13 +515,35 @@ namespace SGI {
   {
     if (_sidebarState == SidebarState::LEFT_OPEN || _sidebarState == SidebarState::LEFT_OPENING) {
       _sidebarState = SidebarState::LEFT_CLOSING;
+      _invalidate();
       LOG(WINDOW, "Sidebar closing");
     } else if (_sidebarState == SidebarState::RIGHT_OPEN || _sidebarState == SidebarState::RIGHT_OPENING) {
       _sidebarState = SidebarState::RIGHT_CLOSING;
+      _invalidate();
       LOG(WINDOW, "Sidebar closing");
     }
   }
 
+  bool Window::isDamageTracking()
+  {
+    return _damageTracking;
+  }
+
+  bool Window::isDrawBatching()
+  {
+    return _drawBatching;
+  }
+
+  bool Window::isPointerRouting()
+  {
+    return _pointerRouting;
+  }
+
+  bool Window::isProfiling()
+  {
+    return _profiling;
+  }
+
   bool Window::isSidebarOpen()
   {
     return _sidebarState != SidebarState::CLOSED;
@@ -201,13 +571,41 @@ namespace SGI {
       return false;
     }
 
+    if (_profiling && !_profilingEvent) {
+      _profilingEvent = true;
+      double start = Profiler::milliseconds();
+      bool stop = processEvent(event);
+      _eventTime += Profiler::milliseconds() - start;
+      _profilingEvent = false;
+      return stop;
+    }
+
+    bool pointer = false;
+    if (_pointerRouting) {
+      switch (event->type) {
+        case SDL_EVENT_MOUSE_MOTION:
+          _pointerPosition = {event->motion.x, event->motion.y};
+          pointer = true;
+          break;
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+          _pointerPosition = {event->button.x, event->button.y};
+          pointer = true;
+          break;
+        case SDL_EVENT_MOUSE_WHEEL:
+          _pointerPosition = {event->wheel.mouse_x, event->wheel.mouse_y};
+          pointer = true;
+          break;
+      }
+    }
+
     if (_sidebarState == SidebarState::CLOSED) {
-      return Container::processEvent(event);
+      return pointer ? _routePointerEvent(event, this) : Container::processEvent(event);
     } else if (!isMouseOverSidebar() && event->type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
       closeSidebar();
       return true;
     } else {
-      return _sidebarContainer->processEvent(event);
+      return pointer ? _routePointerEvent(event, _sidebarContainer.get()) : _sidebarContainer->processEvent(event);
     }
   }
 
@@ -219,11 +617,24 @@ namespace SGI {
     }
   }
 
-  void Window::render(bool present)
+  bool Window::render(bool present)
   {
-    SDL_SetRenderDrawBlendMode(getRenderer().get(), SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(getRenderer().get(), 0, 0, 0, 255);
-    SDL_RenderClear(getRenderer().get());
+    if (_profiling && !_profilingFrame) {
+      _profilingFrame = true;
+      double start = Profiler::milliseconds();
+      bool drawn = render(present);
+      _profilingFrame = false;
+
+      _profile.frameTime = Profiler::milliseconds() - start;
+      _profile.layoutTime = _layoutTime;
+      _profile.eventTime = _eventTime;
+      _profile.drawCalls = _drawBatching ? _drawList.getStats().calls : 0;
+      _profile.textures = Profiler::getTextureCount();
+      _profile.textureBytes = Profiler::getTextureBytes();
+      _layoutTime = 0.0;
+      _eventTime = 0.0;
+      return drawn;
+    }
 
     Uint64 current = SDL_GetTicks();
     double dt = 0;
@@ -231,35 +642,271 @@ namespace SGI {
       dt = current - _lastRenderCount;
     }
     _lastRenderCount = current;
+    _needsRender = false;
+
+    if (_damageTracking && !_frameTexture && !_createFrameTexture()) {
+      ERROR(WINDOW, "Damage tracking disabled");
+      _damageTracking = false;
+    }
+
+    if (!_damageTracking) {
+      SDL_SetRenderDrawBlendMode(getRenderer().get(), SDL_BLENDMODE_BLEND);
+      SDL_SetRenderDrawColor(getRenderer().get(), 0, 0, 0, 255);
+      SDL_RenderClear(getRenderer().get());
+
+      if (_drawBatching) {
+        _drawList.begin(getRenderer().get());
+      }
+      Window::_render(dt / 1000.0);
+      if (_drawBatching) {
+        _drawList.end();
+      }
+
+      if (present) {
+        SDL_RenderPresent(getRenderer().get());
+      }
+      return true;
+    }
+
+    _damageAnimating();
+    if (!_damaged) {
+      return false;
+    }
+
+    // Layout may move widgets, which adds to the damage
+    _updateLayout();
+
+    _damaged = false;
+    if (!SDL_GetRectIntersection(&_damage, &_bounds, &_damageRect)) {
+      return false;
+    }
 
+    SDL_Renderer* renderer = getRenderer().get();
+    SDL_SetRenderTarget(renderer, _frameTexture.get());
+    SDL_SetRenderClipRect(renderer, &_damageRect);
+
+    SDL_FRect clearRect = {(float)_damageRect.x, (float)_damageRect.y, (float)_damageRect.w, (float)_damageRect.h};
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderFillRect(renderer, &clearRect);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    _damageActive = true;
+    if (_drawBatching) {
+      _drawList.begin(renderer, &_damageRect);
+    }
     Window::_render(dt / 1000.0);
+    if (_drawBatching) {
+      _drawList.end();
+    }
+    _damageActive = false;
+
+    SDL_SetRenderClipRect(renderer, nullptr);
+    SDL_SetRenderTarget(renderer, nullptr);
+
+    // The back buffer is undefined after a present, so the retained
+    // frame is copied over in full. That is a single textured quad.
+    SDL_RenderTexture(renderer, _frameTexture.get(), nullptr, nullptr);
+
+    if (present) {
+      SDL_RenderPresent(renderer);
+    }
+    return true;
+  }
+
+  void Window::resetFrameStats()
+  {
+    _frameStats = FrameStats();
+  }
+
+  void Window::run()
+  {
+    SDL_Renderer* renderer = getRenderer().get();
+    bool vsync = SDL_SetRenderVSync(renderer, 1);
+    if (!vsync) {
+      LOG(WINDOW, "VSync not available, pacing frames at %d fps", _frameRate);
+    }
+
+    auto handleEvent = [this](SDL_Event& event) {
+      if (event.type == SDL_EVENT_QUIT) {
+        _running = false;
+        return;
+      }
+      if (event.type >= SDL_EVENT_WINDOW_FIRST && event.type <= SDL_EVENT_WINDOW_LAST) {
+        _needsRender = true;
+      }
+      processEvent(&event);
+    };
+
+    _running = true;
+    _needsRender = true;
+    Uint64 frameStart = SDL_GetTicksNS();
+
+    while (_running) {
+      SDL_Event event;
+
+      // Finished assets invalidate what uses them, so upload them first
+      AssetLoader::update(ASSET_UPLOAD_BUDGET);
+      AudioPlayer::update();
+
+      // Nothing to draw, so sleep until there is an event. The timeout
+      // keeps changes made outside of event handlers from being missed
+      // for long.
+      if (!_needsRender && !_isAnimating()) {
+        Uint64 waitStart = SDL_GetTicksNS();
+        bool received = SDL_WaitEventTimeout(&event, 250);
+        _frameStats.idleTime += (SDL_GetTicksNS() - waitStart) / 1000000.0;
+        _frameStats.waits++;
+        frameStart = SDL_GetTicksNS();
+        if (received) {
+          handleEvent(event);
+        }
+      }
+
+      while (_running && SDL_PollEvent(&event)) {
+        handleEvent(event);
+      }
+      if (!_running) {
+        break;
+      }
+
+      bool presented = false;
+      if (_needsRender || _isAnimating()) {
+        presented = render();
+      }
+
+      Uint64 frameEnd = SDL_GetTicksNS();
+      double frameTime = (frameEnd - frameStart) / 1000000.0;
+      _frameStats.busyTime += frameTime;
+      if (presented) {
+        _frameStats.frames++;
+        if (frameTime > _frameStats.maxFrameTime) {
+          _frameStats.maxFrameTime = frameTime;
+        }
+      }
+
+      // A presented frame already waited for vsync
+      if (_frameRate > 0 && !(vsync && presented)) {
+        Uint64 frameDuration = 1000000000 / _frameRate;
+        if (frameEnd - frameStart < frameDuration) {
+          SDL_DelayNS(frameDuration - (frameEnd - frameStart));
+          _frameStats.idleTime += (SDL_GetTicksNS() - frameEnd) / 1000000.0;
+        }
+      }
+      frameStart = SDL_GetTicksNS();
+    }
+
+    _running = false;
+  }
+
+  void Window::renderDebug(bool present)
+  {
+    if (!_profiling) {
+      setProfiling(true);
+    }
+
+    SDL_Renderer* renderer = getRenderer().get();
+    if (!render(false) && _frameTexture) {
+      // Nothing was damaged, so the back buffer still needs the last frame
+      SDL_RenderTexture(renderer, _frameTexture.get(), nullptr, nullptr);
+    }
+
+    std::vector<std::string> lines;
+    char line[256];
+
+    snprintf(line, sizeof(line), "frame %.2f ms  layout %.2f ms  events %.2f ms", _profile.frameTime, _profile.layoutTime, _profile.eventTime);
+    lines.push_back(line);
+
+    if (_drawBatching) {
+      snprintf(line, sizeof(line), "draw calls %zu", _profile.drawCalls);
+    } else {
+      snprintf(line, sizeof(line), "draw calls n/a, batching is off");
+    }
+    lines.push_back(line);
+
+    snprintf(line, sizeof(line), "textures %zu  %.1f MB", _profile.textures, _profile.textureBytes / (1024.0 * 1024.0));
+    lines.push_back(line);
+
+    lines.push_back("slowest widgets");
+    for (const auto& widget : getSlowestWidgets(DEBUG_WIDGET_COUNT)) {
+      std::string name = widget->getName().empty() ? "#" + std::to_string(widget->getId()) : widget->getName();
+      RenderProfile profile = widget->getRenderProfile();
+      snprintf(line, sizeof(line), "  %s  %.3f ms avg  %.3f ms max", name.c_str(), profile.totalTime / profile.frames, profile.maxTime);
+      lines.push_back(line);
+    }
+
+    int width = 0;
+    int height = 0;
+    for (const auto& text : lines) {
+      int lineWidth, lineHeight;
+      if (FontBook::measure(DEBUG_FONT, DEBUG_FONT_SIZE, text, &lineWidth, &lineHeight)) {
+        width = std::max(width, lineWidth);
+        height = std::max(height, lineHeight);
+      }
+    }
+
+    if (width > 0) {
+      SDL_FRect background = {0, 0, (float)width + 16, (float)(height * lines.size()) + 16};
+      SDL_SetRenderClipRect(renderer, nullptr);
+      SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+      SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192);
+      SDL_RenderFillRect(renderer, &background);
+
+      SDL_Color color = {255, 255, 255, 255};
+      for (size_t i = 0; i < lines.size(); ++i) {
+        FontBook::draw(renderer, DEBUG_FONT, DEBUG_FONT_SIZE, lines[i], color, 8, 8 + (float)(height * i));
+      }
+    } else {
+      ERROR(WINDOW, "Debug overlay needs the \"%s\" font", DEBUG_FONT);
+    }
 
     if (present) {
-      SDL_RenderPresent(getRenderer().get());
+      SDL_RenderPresent(renderer);
     }
   }
 
-  void Window::renderTexture(std::string textureName, const SDL_FRect& destRect, double angle, float scale)
+  void Window::renderTexture(std::string textureName, const SDL_FRect& destRect, double angle, float scale, SDL_Color color)
   {
     std::shared_ptr<TextureData> data = getTexture(textureName);
     if (!data) {
+      if (_pendingTextures.count(textureName) > 0) {
+        _renderPlaceholder(destRect);
+        return;
+      }
       ERROR(TEXTURECACHE, "Texture %s not found", textureName.c_str());
       return;
     }
 
+    // Atlas pages are shared, so the color is set for every draw
+    SDL_Texture* texture = data->texture.get();
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+
+    DrawList* drawList = DrawList::get(getRenderer().get());
     if (data->sliced) {
-      TextureSlice sliceInfo = data->sliceInfo;
       // TODO: figure out how to rotate this
-      SDL_RenderTexture9Grid(getRenderer().get(), data->texture.get(), nullptr, sliceInfo.x1, sliceInfo.x2, sliceInfo.y1, sliceInfo.y2, scale, &destRect);
+      if (drawList) {
+        _renderTexture9Grid(*data, destRect, scale, drawList);
+        return;
+      }
+
+      TextureSlice sliceInfo = data->sliceInfo;
+      SDL_RenderTexture9Grid(getRenderer().get(), texture, &data->source, sliceInfo.x1, sliceInfo.x2, sliceInfo.y1, sliceInfo.y2, scale, &destRect);
     } else {
+      if (drawList) {
+        drawList->texture(texture, &data->source, destRect, angle);
+        return;
+      }
+
       SDL_FPoint center = {destRect.w / 2, destRect.h / 2};
-      SDL_RenderTextureRotated(getRenderer().get(), data->texture.get(), nullptr, &destRect, angle, &center, SDL_FLIP_NONE);
+      SDL_RenderTextureRotated(getRenderer().get(), texture, &data->source, &destRect, angle, &center, SDL_FLIP_NONE);
     }
   }
 
   void Window::setBackgroundTexture(const std::string textureName)
   {
     _backgroundTexture = textureName;
+    _invalidate();
   }
 
 
@@ -347,19 +994,71 @@ namespace SGI {
     _cursor = cursorType;
   }
 
+  void Window::setDamageTracking(bool value)
+  {
+    _damageTracking = value;
+    if (!_damageTracking) {
+      _frameTexture = nullptr;
+    }
+    _invalidate();
+  }
+
+  void Window::setDrawBatching(bool value)
+  {
+    _drawBatching = value;
+  }
+
   void Window::setFocused(std::shared_ptr<Widget> widget)
   {
     if (_focused) {
       _focused->_focused = false;
+      _focused->_invalidate();
     }
     _focused = nullptr;
 
     if (widget) {
       _focused = widget;
       _focused->_focused = true;
+      _focused->_invalidate();
     }
   }
 
+  void Window::setFrameRate(int fps)
+  {
+    _frameRate = fps < 0 ? 0 : fps;
+  }
+
+  void Window::setPointerRouting(bool value)
+  {
+    _pointerRouting = value;
+    _hitTestCells.clear();
+    _hitTestWidgets.clear();
+    _pointerWidgets.clear();
+
+    if (!_pointerRouting) {
+      return;
+    }
+
+    std::function<void(Widget*)> indexTree = [&](Widget* widget) {
+      _indexWidget(widget);
+      if (Container* container = dynamic_cast<Container*>(widget)) {
+        for (const auto& child : container->_children) {
+          indexTree(child.get());
+        }
+      }
+    };
+    indexTree(this);
+    indexTree(_sidebarContainer.get());
+  }
+
+  void Window::setProfiling(bool value)
+  {
+    _profiling = value;
+    _profile = Profile();
+    _eventTime = 0.0;
+    _layoutTime = 0.0;
+  }
+
   void Window::setResourcePath(std::string path) {
     _resourcePath = path;
     if (_resourcePath.empty() || _resourcePath.back() == '/') {
@@ -367,15 +1066,480 @@ namespace SGI {
     }
   }
 
-  void Window::setTheme(const std::string& name)
+  void Window::stop()
+  {
+    _running = false;
+  }
+
+  void Window::_addAnimating(WidgetPtr widget)
+  {
+    for (const auto& animating : _animatingWidgets) {
+      if (animating.lock() == widget) {
+        return;
+      }
+    }
+    _animatingWidgets.push_back(widget);
+  }
+
+  bool Window::_addCursor(CursorType cursorType, SDL_Surface* surface, const SDL_Point& hotspot)
   {
-    Container::setTheme(name);
-    _sidebarContainer->setTheme(name);
+    SDL_Cursor* cursor = SDL_CreateColorCursor(surface, hotspot.x, hotspot.y);
+    if (!cursor) {
+      ERROR(WINDOW, "Cursor not created: %s", SDL_GetError());
+      return false;
+    }
+
+    auto cursorPtr = std::shared_ptr<SDL_Cursor>(cursor, [](SDL_Cursor* p) {
+      if (p) {
+        LOG(MEMORY, "SDL_Cursor has been freed");
+        SDL_DestroyCursor(p);
+      }
+    });
+
+    _cursorCache[cursorType] = cursorPtr;
+
+    return true;
+  }
+
+  void Window::_addDamage(const SDL_Rect& rect)
+  {
+    if (rect.w <= 0 || rect.h <= 0) {
+      return;
+    }
+
+    _needsRender = true;
+    if (!_damageTracking) {
+      return;
+    }
+
+    if (_damaged) {
+      SDL_GetRectUnion(&_damage, &rect, &_damage);
+    } else {
+      _damage = rect;
+      _damaged = true;
+    }
+  }
+
+  void Window::_addPointerWidget(WidgetPtr widget)
+  {
+    for (const auto& pointerWidget : _pointerWidgets) {
+      if (pointerWidget.lock() == widget) {
+        return;
+      }
+    }
+    _pointerWidgets.push_back(widget);
+  }
+
+  bool Window::_addTexture(const std::string& textureName, SDL_Surface* surface, const TextureSlice& sliceInfo)
+  {
+    SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTextureFromSurface(getRenderer().get(), surface));
+
+    if (!texture) {
+      LOG(TEXTURE, "Unable to create texture %s: %s", textureName.c_str(), SDL_GetError());
+      return false;
+    }
+
+    auto textureData = std::make_shared<TextureData>(TextureData{
+      std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
+        if (p) {
+          LOG(MEMORY, "SDL_Texture has been freed");
+          SDL_DestroyTexture(p);
+        }
+      }),
+      surface->w,
+      surface->h,
+      isSliced(sliceInfo),
+      sliceInfo,
+      {0, 0, (float)surface->w, (float)surface->h}
+    });
+
+    _textureCache[textureName] = textureData;
+    LOG(TEXTURE, "Texture %s added", textureName.c_str());
+    return true;
+  }
+
+  bool Window::_createFrameTexture()
+  {
+    SDL_Texture* texture = Profiler::trackTexture(SDL_CreateTexture(getRenderer().get(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, _bounds.w, _bounds.h));
+    if (!texture) {
+      ERROR(WINDOW, "Unable to create frame texture: %s", SDL_GetError());
+      return false;
+    }
+
+    _frameTexture = std::shared_ptr<SDL_Texture>(texture, [](SDL_Texture* p) {
+      if (p) {
+        LOG(MEMORY, "SDL_Texture has been freed");
+        SDL_DestroyTexture(p);
+      }
+    });
+    LOG(MEMORY, "Frame texture has been created");
+
+    _addDamage(_bounds);
+    return true;
+  }
+
+  void Window::_damageAnimating()
+  {
+    if (_sidebarState == SidebarState::LEFT_OPENING || _sidebarState == SidebarState::LEFT_CLOSING) {
+      _addDamage(_bounds);
+    }
+
+    for (auto it = _animatingWidgets.begin(); it != _animatingWidgets.end();) {
+      WidgetPtr widget = it->lock();
+      if (!widget || !widget->_animating || widget->_root.get() != this) {
+        it = _animatingWidgets.erase(it);
+        continue;
+      }
+      widget->_invalidate();
+      ++it;
+    }
+  }
+
+  void Window::_clearHitTestCells(Widget* widget, const SDL_Rect& cells)
+  {
+    for (int cellY = cells.y; cellY <= cells.h; ++cellY) {
+      for (int cellX = cells.x; cellX <= cells.w; ++cellX) {
+        auto cell = _hitTestCells.find(hitTestKey(cellX, cellY));
+        if (cell == _hitTestCells.end()) {
+          continue;
+        }
+        cell->second.erase(std::remove(cell->second.begin(), cell->second.end(), widget), cell->second.end());
+        if (cell->second.empty()) {
+          _hitTestCells.erase(cell);
+        }
+      }
+    }
+  }
+
+  void Window::_detachWidget(Widget* widget)
+  {
+    _removeHitTestCells(widget);
+
+    std::function<void(Widget*)> unindexTree = [&](Widget* current) {
+      _unindexName(current, current->_name);
+      if (Container* container = dynamic_cast<Container*>(current)) {
+        for (const auto& child : container->_children) {
+          unindexTree(child.get());
+        }
+      }
+    };
+    unindexTree(widget);
+  }
+
+  void Window::_findNamed(const Container* ancestor, const std::string& name, bool first, std::vector<WidgetPtr>& result)
+  {
+    auto it = _nameIndex.find(name);
+    if (it == _nameIndex.end()) {
+      return;
+    }
+
+    std::vector<Widget*> matches;
+    for (Widget* widget : it->second) {
+      for (Container* parent = widget->_parent; parent != nullptr; parent = parent->_parent) {
+        if (parent == ancestor) {
+          matches.push_back(widget);
+          break;
+        }
+      }
+    }
+
+    // The index is in the order widgets were added, so when there is
+    // more than one match they are put in the order a tree walk finds them
+    std::vector<std::pair<std::vector<size_t>, Widget*>> ordered;
+    if (matches.size() > 1) {
+      for (Widget* match : matches) {
+        std::vector<size_t> path;
+        for (Widget* widget = match; widget != ancestor; widget = widget->_parent) {
+          const auto& siblings = widget->_parent->_children;
+          auto sibling = std::find_if(siblings.begin(), siblings.end(), [widget](const WidgetPtr& child) {
+            return child.get() == widget;
+          });
+          path.push_back(sibling - siblings.begin());
+        }
+        std::reverse(path.begin(), path.end());
+        ordered.emplace_back(std::move(path), match);
+      }
+
+      if (first) {
+        auto firstMatch = std::min_element(ordered.begin(), ordered.end());
+        matches = {firstMatch->second};
+      } else {
+        std::sort(ordered.begin(), ordered.end());
+        matches.clear();
+        for (const auto& [path, match] : ordered) {
+          matches.push_back(match);
+        }
+      }
+    }
+
+    for (Widget* match : matches) {
+      if (match->_self) {
+        result.push_back(match->_self);
+      }
+    }
+  }
+
+  void Window::_indexName(Widget* widget)
+  {
+    if (widget->_name.empty()) {
+      return;
+    }
+
+    std::vector<Widget*>& widgets = _nameIndex[widget->_name];
+    if (std::find(widgets.begin(), widgets.end(), widget) == widgets.end()) {
+      widgets.push_back(widget);
+    }
+  }
+
+  void Window::_indexWidget(Widget* widget)
+  {
+    if (!_pointerRouting || widget == this) {
+      return;
+    }
+
+    // A widget that left the window takes its children with it
+    if (widget->_root.get() != this) {
+      _removeHitTestCells(widget);
+      return;
+    }
+
+    const SDL_Rect& bounds = widget->_bounds;
+    bool indexed = bounds.w > 0 && bounds.h > 0;
+    SDL_Rect cells = {0, 0, 0, 0};
+    if (indexed) {
+      cells.x = hitTestCell(bounds.x);
+      cells.y = hitTestCell(bounds.y);
+      cells.w = hitTestCell(bounds.x + bounds.w - 1);
+      cells.h = hitTestCell(bounds.y + bounds.h - 1);
+    }
+
+    auto it = _hitTestWidgets.find(widget);
+    if (it != _hitTestWidgets.end()) {
+      if (indexed && SDL_RectsEqual(&it->second, &cells)) {
+        return;
+      }
+      // Only this widget moved, its children are indexed on their own
+      _clearHitTestCells(widget, it->second);
+      _hitTestWidgets.erase(it);
+    }
+
+    if (!indexed) {
+      return;
+    }
+
+    for (int cellY = cells.y; cellY <= cells.h; ++cellY) {
+      for (int cellX = cells.x; cellX <= cells.w; ++cellX) {
+        _hitTestCells[hitTestKey(cellX, cellY)].push_back(widget);
+      }
+    }
+    _hitTestWidgets[widget] = cells;
+  }
+
+  bool Window::_isAnimating()
+  {
+    if (_sidebarState == SidebarState::LEFT_OPENING || _sidebarState == SidebarState::LEFT_CLOSING ||
+        _sidebarState == SidebarState::RIGHT_OPENING || _sidebarState == SidebarState::RIGHT_CLOSING) {
+      return true;
+    }
+
+    for (auto it = _animatingWidgets.begin(); it != _animatingWidgets.end();) {
+      WidgetPtr widget = it->lock();
+      if (!widget || !widget->_animating || widget->_root.get() != this) {
+        it = _animatingWidgets.erase(it);
+        continue;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  bool Window::_isInLayer(Widget* widget, Widget* layer)
+  {
+    if (widget->_root.get() != this) {
+      return false;
+    }
+
+    Widget* top = widget;
+    while (top->_parent != nullptr) {
+      top = top->_parent;
+    }
+    return top == layer;
+  }
+
+  void Window::_removeHitTestCells(Widget* widget)
+  {
+    auto it = _hitTestWidgets.find(widget);
+    if (it != _hitTestWidgets.end()) {
+      _clearHitTestCells(widget, it->second);
+      _hitTestWidgets.erase(it);
+    }
+
+    // A container with no bounds can still have indexed children
+    if (Container* container = dynamic_cast<Container*>(widget)) {
+      for (const auto& child : container->_children) {
+        _removeHitTestCells(child.get());
+      }
+    }
+  }
+
+  bool Window::_routePointerEvent(const SDL_Event *event, Widget* layer)
+  {
+    std::vector<WidgetPtr> targets;
+    auto addTarget = [&](const WidgetPtr& widget) {
+      if (widget && _isInLayer(widget.get(), layer) && std::find(targets.begin(), targets.end(), widget) == targets.end()) {
+        targets.push_back(widget);
+      }
+    };
+
+    // The widgets under the pointer, tested the same way as _checkMouseInBounds
+    float x = _pointerPosition.x;
+    float y = _pointerPosition.y;
+    auto cell = _hitTestCells.find(hitTestKey(hitTestCell(static_cast<int>(floor(x))), hitTestCell(static_cast<int>(floor(y)))));
+    if (cell != _hitTestCells.end()) {
+      for (Widget* widget : cell->second) {
+        const SDL_Rect& bounds = widget->_bounds;
+        if (x > bounds.x && x < bounds.x + bounds.w && y > bounds.y && y < bounds.y + bounds.h) {
+          addTarget(widget->_self);
+        }
+      }
+    }
+
+    // The widgets that may have to react to the pointer leaving them
+    for (const auto& pointerWidget : _pointerWidgets) {
+      addTarget(pointerWidget.lock());
+    }
+    addTarget(_focused);
+    addTarget(layer->_self);
+
+    // Route in the order Container::processEvent would, children before
+    // their parents and siblings in the order they were added
+    std::vector<std::pair<std::vector<size_t>, WidgetPtr>> ordered;
+    ordered.reserve(targets.size());
+    for (const auto& target : targets) {
+      std::vector<size_t> path;
+      for (Widget* widget = target.get(); widget->_parent != nullptr; widget = widget->_parent) {
+        const auto& siblings = widget->_parent->_children;
+        auto it = std::find_if(siblings.begin(), siblings.end(), [widget](const WidgetPtr& sibling) {
+          return sibling.get() == widget;
+        });
+        path.push_back(it - siblings.begin());
+      }
+      std::reverse(path.begin(), path.end());
+      ordered.emplace_back(std::move(path), target);
+    }
+
+    std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+      size_t count = std::min(a.first.size(), b.first.size());
+      for (size_t i = 0; i < count; ++i) {
+        if (a.first[i] != b.first[i]) {
+          return a.first[i] < b.first[i];
+        }
+      }
+      return a.first.size() > b.first.size();
+    });
+
+    bool stop = false;
+    for (const auto& [path, widget] : ordered) {
+      // An earlier handler may have removed it
+      if (!_isInLayer(widget.get(), layer)) {
+        continue;
+      }
+      if (widget->_processPointerEvent(event)) {
+        stop = true;
+        break;
+      }
+    }
+
+    // Keep the widgets that are hovered, hold a button or capture the
+    // pointer, including any that started capturing during the event
+    std::vector<std::weak_ptr<Widget>> pointerWidgets;
+    std::vector<WidgetPtr> candidates = targets;
+    for (const auto& pointerWidget : _pointerWidgets) {
+      if (WidgetPtr widget = pointerWidget.lock()) {
+        candidates.push_back(widget);
+      }
+    }
+    for (const auto& widget : candidates) {
+      if (widget.get() == layer || widget->_root.get() != this) {
+        continue;
+      }
+
+      bool pressed = false;
+      for (const auto& [button, down] : widget->_mouseButtonState) {
+        pressed = pressed || down;
+      }
+
+      if (!widget->_mouseOver && !widget->_pointerCapture && !pressed) {
+        continue;
+      }
+      auto it = std::find_if(pointerWidgets.begin(), pointerWidgets.end(), [&widget](const std::weak_ptr<Widget>& pointerWidget) {
+        return pointerWidget.lock() == widget;
+      });
+      if (it == pointerWidgets.end()) {
+        pointerWidgets.push_back(widget);
+      }
+    }
+    _pointerWidgets = std::move(pointerWidgets);
+
+    return stop;
+  }
+
+  void Window::_unindexName(Widget* widget, const std::string& name)
+  {
+    auto it = _nameIndex.find(name);
+    if (it == _nameIndex.end()) {
+      return;
+    }
+
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), widget), it->second.end());
+    if (it->second.empty()) {
+      _nameIndex.erase(it);
+    }
+  }
+
+  void Window::_renderPlaceholder(const SDL_FRect& destRect)
+  {
+    DrawList* drawList = DrawList::get(getRenderer().get());
+    if (drawList) {
+      drawList->fillRect(destRect, PLACEHOLDER_COLOR);
+      return;
+    }
+
+    SDL_Renderer* renderer = getRenderer().get();
+    SDL_BlendMode blendMode;
+    SDL_GetRenderDrawBlendMode(renderer, &blendMode);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, PLACEHOLDER_COLOR.r, PLACEHOLDER_COLOR.g, PLACEHOLDER_COLOR.b, PLACEHOLDER_COLOR.a);
+    SDL_RenderFillRect(renderer, &destRect);
+    SDL_SetRenderDrawBlendMode(renderer, blendMode);
+  }
+
+  void Window::_renderTexture9Grid(const TextureData& data, const SDL_FRect& destRect, float scale, DrawList* drawList)
+  {
+    const SDL_FRect& source = data.source;
+    const TextureSlice& slice = data.sliceInfo;
+
+    float sourceX[4] = {source.x, source.x + slice.x1, source.x + source.w - slice.x2, source.x + source.w};
+    float sourceY[4] = {source.y, source.y + slice.y1, source.y + source.h - slice.y2, source.y + source.h};
+    float destX[4] = {destRect.x, destRect.x + slice.x1 * scale, destRect.x + destRect.w - slice.x2 * scale, destRect.x + destRect.w};
+    float destY[4] = {destRect.y, destRect.y + slice.y1 * scale, destRect.y + destRect.h - slice.y2 * scale, destRect.y + destRect.h};
+
+    for (int row = 0; row < 3; ++row) {
+      for (int column = 0; column < 3; ++column) {
+        SDL_FRect src = {sourceX[column], sourceY[row], sourceX[column + 1] - sourceX[column], sourceY[row + 1] - sourceY[row]};
+        SDL_FRect dest = {destX[column], destY[row], destX[column + 1] - destX[column], destY[row + 1] - destY[row]};
+        if (src.w <= 0 || src.h <= 0 || dest.w <= 0 || dest.h <= 0) {
+          continue;
+        }
+        drawList->texture(data.texture.get(), &src, dest);
+      }
+    }
   }
 
   void Window::_setBounds(SDL_Rect& bounds)
   {
     Container::_setBounds(bounds);
+    _frameTexture = nullptr;
 
     _sidebarBounds.y = 0;
     _sidebarBounds.h = _bounds.h;
@@ -391,6 +1555,14 @@ namespace SGI {
     _sidebarContainer->_setBounds(_sidebarBounds);
   }
 
+  void Window::_setTheme(const Theme* theme)
+  {
+    Container::_setTheme(theme);
+    if (_sidebarContainer) {
+      _sidebarContainer->_setTheme(theme);
+    }
+  }
+
   void Window::_render(double deltaTime)
   {
     if (!_backgroundTexture.empty()) {
@@ -421,7 +1593,7 @@ namespace SGI {
     }
 
     if (_sidebarState != SidebarState::CLOSED) {
-      _sidebarContainer->_render(deltaTime);
+      _sidebarContainer->_drawProfiled(deltaTime);
       _sidebarContainer->_renderOverlay(deltaTime);
     }
   }
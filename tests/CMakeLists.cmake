@@ -7,7 +7,12 @@ FetchContent_Declare(
 FetchContent_MakeAvailable(catch2)
 
 add_executable(${APP_NAME}-test ${LIBRARY_SOURCES}
+  tests/audioplayer.cpp
+  tests/bundle.cpp
   tests/container.cpp
+  tests/listeners.cpp
+  tests/mixkernel.cpp
+  tests/spscqueue.cpp
 )
 
 target_include_directories(${APP_NAME}-test PRIVATE
@@ -28,6 +33,7 @@ if(SDL STREQUAL "STATIC")
     SDL3_net::SDL3_net-static
     SDL3_ttf::SDL3_ttf-static ${FREETYPE_LIBRARIES}
     vorbisenc vorbisfile vorbis
+    Threads::Threads
     Catch2::Catch2WithMain
   )
 else()
@@ -38,6 +44,7 @@ else()
     SDL3_net::SDL3_net
     SDL3_ttf::SDL3_ttf ${FREETYPE_LIBRARIES}
     vorbisenc vorbisfile vorbis
+    Threads::Threads
     Catch2::Catch2WithMain
   )
 endif()
@@ -0,0 +1,151 @@
+#include <catch2/catch_all.hpp>
+#include <SDL3/SDL.h>
+#include <string>
+
+#include "audioplayer.h"
+
+using AudioPlayer = SGI::AudioPlayer;
+
+// A tone that repeats, so no instance ends on its own while a test runs
+static void createTone(const std::string& id)
+{
+  SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+  AudioPlayer::newBuffer(id);
+  REQUIRE(AudioPlayer::bufferAddTone(id, 440, 100, 1, 0));
+}
+
+static Uint32 voiceOf(AudioPlayer::VoiceHandle handle)
+{
+  return static_cast<Uint32>(handle);
+}
+
+TEST_CASE("AudioPlayer plays a sound many times at once", "[audio]") {
+  createTone("pool");
+
+  AudioPlayer::VoiceHandle first = AudioPlayer::play("pool", true);
+  AudioPlayer::VoiceHandle second = AudioPlayer::play("pool", true);
+  REQUIRE(first != 0);
+  REQUIRE(second != 0);
+  REQUIRE(voiceOf(first) != voiceOf(second));
+  REQUIRE(AudioPlayer::isPlaying(first));
+  REQUIRE(AudioPlayer::isPlaying(second));
+
+  AudioPlayer::stop(first);
+  REQUIRE_FALSE(AudioPlayer::isPlaying(first));
+  REQUIRE(AudioPlayer::isPlaying(second));
+  REQUIRE(AudioPlayer::isPlaying("pool"));
+
+  AudioPlayer::stop("pool");
+  REQUIRE_FALSE(AudioPlayer::isPlaying(second));
+  REQUIRE_FALSE(AudioPlayer::isPlaying("pool"));
+  AudioPlayer::unload("pool");
+}
+
+TEST_CASE("AudioPlayer handles of reused voices stay stale", "[audio]") {
+  createTone("reuse");
+
+  AudioPlayer::VoiceHandle first = AudioPlayer::play("reuse", true);
+  REQUIRE(first != 0);
+  AudioPlayer::stop(first);
+
+  // The free voice is used again, but with a new handle
+  AudioPlayer::VoiceHandle second = AudioPlayer::play("reuse", true);
+  REQUIRE(second != 0);
+  REQUIRE(voiceOf(second) == voiceOf(first));
+  REQUIRE(second != first);
+  REQUIRE_FALSE(AudioPlayer::isPlaying(first));
+
+  // The old handle must not reach the new instance
+  AudioPlayer::pause(first);
+  AudioPlayer::setGain(first, 0.0f);
+  AudioPlayer::stop(first);
+  REQUIRE(AudioPlayer::isPlaying(second));
+
+  AudioPlayer::pause(second);
+  REQUIRE_FALSE(AudioPlayer::isPlaying(second));
+  AudioPlayer::resume(second);
+  REQUIRE(AudioPlayer::isPlaying(second));
+
+  AudioPlayer::unload("reuse");
+  REQUIRE_FALSE(AudioPlayer::isPlaying(second));
+}
+
+TEST_CASE("AudioPlayer resumes a paused sound instead of playing it again", "[audio]") {
+  createTone("paused");
+
+  AudioPlayer::VoiceHandle handle = AudioPlayer::play("paused", true);
+  REQUIRE(handle != 0);
+  AudioPlayer::pause("paused");
+  REQUIRE_FALSE(AudioPlayer::isPlaying(handle));
+
+  REQUIRE(AudioPlayer::play("paused", true) == handle);
+  REQUIRE(AudioPlayer::isPlaying(handle));
+
+  AudioPlayer::unload("paused");
+}
+
+TEST_CASE("AudioPlayer steals the oldest instance over the limit", "[audio]") {
+  createTone("oldest");
+  AudioPlayer::setMaxInstances("oldest", 2, AudioPlayer::Steal::Oldest);
+
+  AudioPlayer::VoiceHandle first = AudioPlayer::play("oldest", true);
+  AudioPlayer::VoiceHandle second = AudioPlayer::play("oldest", true);
+  AudioPlayer::VoiceHandle third = AudioPlayer::play("oldest", true);
+  REQUIRE(first != 0);
+  REQUIRE(second != 0);
+  REQUIRE(third != 0);
+
+  REQUIRE(voiceOf(third) == voiceOf(first));
+  REQUIRE_FALSE(AudioPlayer::isPlaying(first));
+  REQUIRE(AudioPlayer::isPlaying(second));
+  REQUIRE(AudioPlayer::isPlaying(third));
+
+  // Second is now the oldest
+  AudioPlayer::VoiceHandle fourth = AudioPlayer::play("oldest", true);
+  REQUIRE(voiceOf(fourth) == voiceOf(second));
+  REQUIRE_FALSE(AudioPlayer::isPlaying(second));
+  REQUIRE(AudioPlayer::isPlaying(third));
+  REQUIRE(AudioPlayer::isPlaying(fourth));
+
+  AudioPlayer::unload("oldest");
+}
+
+TEST_CASE("AudioPlayer doesn't play over the limit without stealing", "[audio]") {
+  createTone("none");
+  AudioPlayer::setMaxInstances("none", 2, AudioPlayer::Steal::None);
+
+  AudioPlayer::VoiceHandle first = AudioPlayer::play("none", true);
+  AudioPlayer::VoiceHandle second = AudioPlayer::play("none", true);
+  REQUIRE(first != 0);
+  REQUIRE(second != 0);
+
+  REQUIRE(AudioPlayer::play("none", true) == 0);
+  REQUIRE(AudioPlayer::isPlaying(first));
+  REQUIRE(AudioPlayer::isPlaying(second));
+
+  // Stopping one makes room again
+  AudioPlayer::stop(first);
+  AudioPlayer::VoiceHandle third = AudioPlayer::play("none", true);
+  REQUIRE(third != 0);
+  REQUIRE(AudioPlayer::isPlaying(second));
+  REQUIRE(AudioPlayer::isPlaying(third));
+
+  // No limit plays as many as there are voices for
+  AudioPlayer::setMaxInstances("none", 0, AudioPlayer::Steal::None);
+  REQUIRE(AudioPlayer::play("none", true) != 0);
+
+  AudioPlayer::unload("none");
+}
+
+TEST_CASE("AudioPlayer frees an unloaded sound once the audio thread is done with it", "[audio]") {
+  createTone("retired");
+  REQUIRE(AudioPlayer::play("retired", true) != 0);
+  AudioPlayer::unload("retired");
+
+  // Nothing else is unloaded or replaced, update alone has to free it
+  for (int i = 0; i < 200 && AudioPlayer::getRetiredBytes() > 0; ++i) {
+    SDL_Delay(10);
+    AudioPlayer::update();
+  }
+  REQUIRE(AudioPlayer::getRetiredBytes() == 0);
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch_all.hpp>
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+#include "bundle.h"
+
+static std::vector<Uint8> roundTrip(const std::vector<Uint8>& data)
+{
+  std::vector<Uint8> compressed = SGI::Bundle::compress(data.data(), data.size());
+  REQUIRE_FALSE(compressed.empty());
+  REQUIRE(compressed.size() < data.size());
+
+  std::vector<Uint8> output(data.size());
+  REQUIRE(SGI::Bundle::decompress(compressed.data(), compressed.size(), output.data(), output.size()));
+  return output;
+}
+
+static std::vector<Uint8> noise(size_t size, Uint32 seed)
+{
+  std::vector<Uint8> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    data[i] = static_cast<Uint8>(seed >> 24);
+  }
+  return data;
+}
+
+TEST_CASE("Bundle compresses and decompresses repeated text", "[bundle]") {
+  std::string text;
+  for (int i = 0; i < 200; ++i) {
+    text += "widget " + std::to_string(i % 7) + " draws itself; ";
+  }
+  std::vector<Uint8> data(text.begin(), text.end());
+  REQUIRE(roundTrip(data) == data);
+}
+
+TEST_CASE("Bundle compresses long runs and overlapping matches", "[bundle]") {
+  // A run longer than a token can hold needs the extra length bytes,
+  // and its match overlaps the bytes it writes
+  std::vector<Uint8> data(70000, 'a');
+  data[1000] = 'b';
+  std::vector<Uint8> tail = noise(300, 7);
+  data.insert(data.end(), tail.begin(), tail.end());
+  REQUIRE(roundTrip(data) == data);
+}
+
+TEST_CASE("Bundle only matches within the offset limit", "[bundle]") {
+  // The same block twice, further apart than an offset can reach, and
+  // then again close by
+  std::vector<Uint8> block = noise(4096, 1);
+  std::vector<Uint8> data = block;
+  std::vector<Uint8> gap = noise(70000, 2);
+  data.insert(data.end(), gap.begin(), gap.end());
+  data.insert(data.end(), block.begin(), block.end());
+  data.insert(data.end(), block.begin(), block.end());
+  REQUIRE(roundTrip(data) == data);
+}
+
+TEST_CASE("Bundle does not compress data that would not shrink", "[bundle]") {
+  std::vector<Uint8> data = noise(4096, 3);
+  REQUIRE(SGI::Bundle::compress(data.data(), data.size()).empty());
+  REQUIRE(SGI::Bundle::compress(data.data(), 0).empty());
+  REQUIRE(SGI::Bundle::compress(data.data(), 3).empty());
+}
+
+TEST_CASE("Bundle rejects corrupt compressed data", "[bundle]") {
+  std::vector<Uint8> data(1000, 'x');
+  std::vector<Uint8> compressed = SGI::Bundle::compress(data.data(), data.size());
+  REQUIRE_FALSE(compressed.empty());
+
+  std::vector<Uint8> output(data.size() + 1);
+  REQUIRE_FALSE(SGI::Bundle::decompress(compressed.data(), compressed.size(), output.data(), data.size() - 1));
+  REQUIRE_FALSE(SGI::Bundle::decompress(compressed.data(), compressed.size(), output.data(), data.size() + 1));
+
+  // Cut off inside the length of the match
+  REQUIRE_FALSE(SGI::Bundle::decompress(compressed.data(), compressed.size() - 2, output.data(), data.size()));
+
+  // A match that reaches back before the start of the output
+  std::vector<Uint8> bad = {0x10, 'x', 0x05, 0x00};
+  REQUIRE_FALSE(SGI::Bundle::decompress(bad.data(), bad.size(), output.data(), 5));
+}
@@ -3,12 +3,41 @@
 #include <cmath>
 #include <SDL3/SDL.h>
 #include <iostream>
+#include <limits>
 
 #include "container.h"
 #include "window.h"
 
 std::string testImagePath = "";
 
+// Lays out its children without a window. Preferred sizes are normally
+// only set by widgets that measure their content, so tests set them here.
+class LayoutBox : public SGI::Container {
+public:
+  static std::shared_ptr<LayoutBox> create(int minWidth = 0, int maxWidth = std::numeric_limits<int>::max())
+  {
+    std::shared_ptr<LayoutBox> widget = std::make_shared<LayoutBox>();
+    widget->_self = widget;
+    widget->setConstraint(SGI::Widget::ConstraintType::Width, minWidth, maxWidth);
+    return widget;
+  }
+
+  void setPreferred(SGI::Widget::ConstraintType constraint, int value)
+  {
+    if (constraint == SGI::Widget::ConstraintType::Width) {
+      _constraints.width.preferredValue = value;
+    } else {
+      _constraints.height.preferredValue = value;
+    }
+  }
+
+  void layout(int width, int height)
+  {
+    SDL_Rect bounds = {0, 0, width, height};
+    _setBounds(bounds);
+  }
+};
+
 SDL_Surface* captureScreenshot(SDL_Renderer* renderer) {
   SDL_Surface* screenshot = SDL_RenderReadPixels(renderer, NULL);
   return screenshot;
@@ -134,3 +163,145 @@ TEST_CASE("Container Widget", "[widgets]") {
   REQUIRE(SDL_Init(SDL_INIT_VIDEO) == SDL_TRUE);
 
 }
+
+TEST_CASE("Container releases its children when destroyed", "[widgets]") {
+  std::shared_ptr<SGI::Container> child = SGI::Container::create();
+  std::shared_ptr<SGI::Container> grandchild = SGI::Container::create();
+  child->addChild(grandchild);
+
+  {
+    std::shared_ptr<SGI::Container> container = SGI::Container::create();
+    container->addChild(child);
+  }
+
+  // Invalidating walks up the parents, which must stop at child now
+  child->setPadding(1, 1, 1, 1);
+  grandchild->setPadding(1, 1, 1, 1);
+
+  std::shared_ptr<SGI::Container> other = SGI::Container::create();
+  other->addChild(child);
+  grandchild->setPadding(2, 2, 2, 2);
+  other->removeChild(child);
+  grandchild->setPadding(3, 3, 3, 3);
+  SUCCEED();
+}
+
+TEST_CASE("Container grows children evenly", "[widgets]") {
+  std::shared_ptr<LayoutBox> row = LayoutBox::create();
+  std::shared_ptr<LayoutBox> children[] = {LayoutBox::create(), LayoutBox::create(), LayoutBox::create()};
+  for (const auto& child : children) {
+    row->addChild(child);
+  }
+
+  // The two pixels that don't divide evenly go to the first children
+  row->layout(302, 50);
+  CHECK(children[0]->getBounds().w == 101);
+  CHECK(children[1]->getBounds().w == 101);
+  CHECK(children[2]->getBounds().w == 100);
+  CHECK(children[1]->getBounds().x == 101);
+  CHECK(children[2]->getBounds().x == 202);
+  CHECK(children[2]->getBounds().h == 50);
+
+  row->setDirection(SGI::Container::Direction::Column);
+  row->layout(50, 300);
+  for (int i = 0; i < 3; ++i) {
+    CHECK(children[i]->getBounds().y == i * 100);
+    CHECK(children[i]->getBounds().h == 100);
+    CHECK(children[i]->getBounds().w == 50);
+  }
+}
+
+TEST_CASE("Container clamps children to their minimum and maximum", "[widgets]") {
+  std::shared_ptr<LayoutBox> row = LayoutBox::create();
+  std::shared_ptr<LayoutBox> capped = LayoutBox::create(50, 60);
+  std::shared_ptr<LayoutBox> flexible = LayoutBox::create();
+  std::shared_ptr<LayoutBox> wide = LayoutBox::create(120, 200);
+  row->addChild(capped);
+  row->addChild(flexible);
+  row->addChild(wide);
+
+  // All grow by 10 until capped is full, then the other two by 50 more
+  row->layout(300, 50);
+  CHECK(capped->getBounds().w == 60);
+  CHECK(flexible->getBounds().w == 60);
+  CHECK(wide->getBounds().w == 180);
+  CHECK(flexible->getBounds().x == 60);
+  CHECK(wide->getBounds().x == 120);
+
+  // Too small for the minimums, they overflow instead of shrinking
+  row->layout(100, 50);
+  CHECK(capped->getBounds().w == 50);
+  CHECK(flexible->getBounds().w == 0);
+  CHECK(wide->getBounds().w == 120);
+  CHECK(wide->getBounds().x == 50);
+
+  // Space the children can't take goes to the spacing
+  std::shared_ptr<LayoutBox> spaced = LayoutBox::create();
+  std::shared_ptr<LayoutBox> first = LayoutBox::create(0, 50);
+  std::shared_ptr<LayoutBox> second = LayoutBox::create(0, 50);
+  spaced->addChild(first);
+  spaced->addChild(second);
+  spaced->layout(300, 50);
+  CHECK(first->getBounds().w == 50);
+  CHECK(second->getBounds().w == 50);
+  CHECK(second->getBounds().x == 250);
+}
+
+TEST_CASE("Container keeps the preferred size of children with a maximum", "[widgets]") {
+  std::shared_ptr<LayoutBox> row = LayoutBox::create();
+  std::shared_ptr<LayoutBox> preferred = LayoutBox::create(0, 200);
+  std::shared_ptr<LayoutBox> flexible = LayoutBox::create();
+  preferred->setPreferred(SGI::Widget::ConstraintType::Width, 40);
+  row->addChild(preferred);
+  row->addChild(flexible);
+
+  row->layout(300, 50);
+  CHECK(preferred->getBounds().w == 40);
+  CHECK(flexible->getBounds().w == 260);
+  CHECK(flexible->getBounds().x == 40);
+
+  // A preferred size above the maximum grows to the maximum
+  preferred->setPreferred(SGI::Widget::ConstraintType::Width, 250);
+  row->layout(500, 50);
+  CHECK(preferred->getBounds().w == 200);
+  CHECK(flexible->getBounds().w == 300);
+
+  std::shared_ptr<LayoutBox> column = LayoutBox::create();
+  std::shared_ptr<LayoutBox> alone = LayoutBox::create();
+  alone->setConstraint(SGI::Widget::ConstraintType::Height, 0, 200);
+  alone->setPreferred(SGI::Widget::ConstraintType::Height, 40);
+  column->setDirection(SGI::Container::Direction::Column);
+  column->addChild(alone);
+  column->layout(100, 300);
+  CHECK(alone->getBounds().h == 40);
+  CHECK(alone->getBounds().w == 100);
+}
+
+TEST_CASE("Container layout", "[.][benchmark]") {
+  REQUIRE(SDL_Init(SDL_INIT_VIDEO) == SDL_TRUE);
+  std::shared_ptr<SGI::Window> window = SGI::Window::create("Layout", 1920, 1080);
+
+  for (int count : {1, 10, 100, 1000, 10000}) {
+    // Build the children before the container is laid out so adding them stays cheap
+    std::shared_ptr<SGI::Container> container = SGI::Container::create();
+    for (int i = 0; i < count; ++i) {
+      std::shared_ptr<SGI::Container> child = SGI::Container::create();
+      child->setConstraint(SGI::Widget::ConstraintType::Width, 0, 1 + i % 5);
+      child->setConstraint(SGI::Widget::ConstraintType::Height, 0, 1 + i % 3);
+      container->addChild(child);
+    }
+    window->addChild(container);
+
+    container->setDirection(SGI::Container::Direction::Row);
+    BENCHMARK("Row of " + std::to_string(count) + " children") {
+      container->setPadding(0, 0, 0, 0);
+    };
+
+    container->setDirection(SGI::Container::Direction::Column);
+    BENCHMARK("Column of " + std::to_string(count) + " children") {
+      container->setPadding(0, 0, 0, 0);
+    };
+
+    window->removeChild(container);
+  }
+}
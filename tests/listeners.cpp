@@ -0,0 +1,100 @@
+#include <catch2/catch_all.hpp>
+#include <vector>
+
+#include "listeners.h"
+
+TEST_CASE("Listeners call handlers in the order they were added", "[listeners]") {
+  SGI::Listeners<int> listeners;
+  std::vector<int> calls;
+  listeners.add([&](int value) { calls.push_back(value * 10 + 1); return false; });
+  listeners.add([&](int value) { calls.push_back(value * 10 + 2); return true; });
+  listeners.add([&](int value) { calls.push_back(value * 10 + 3); return false; });
+
+  REQUIRE(listeners.call(1));
+  REQUIRE(calls == std::vector<int>{11, 12, 13});
+
+  calls.clear();
+  REQUIRE(listeners.callUntilHandled(2));
+  REQUIRE(calls == std::vector<int>{21, 22});
+}
+
+TEST_CASE("Listeners can be removed while they are called", "[listeners]") {
+  SGI::Listeners<> listeners;
+  std::vector<int> calls;
+  SGI::Listeners<>::Handle first = 0;
+  SGI::Listeners<>::Handle second = 0;
+
+  first = listeners.add([&]() {
+    calls.push_back(1);
+    // Removing itself and a handler that has not run yet
+    REQUIRE(listeners.remove(first));
+    REQUIRE(listeners.remove(second));
+    return false;
+  });
+  second = listeners.add([&]() { calls.push_back(2); return false; });
+  listeners.add([&]() { calls.push_back(3); return false; });
+
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1, 3});
+  REQUIRE(listeners.size() == 1);
+
+  calls.clear();
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{3});
+  REQUIRE_FALSE(listeners.remove(first));
+}
+
+TEST_CASE("Listeners added while called run from the next call", "[listeners]") {
+  SGI::Listeners<> listeners;
+  std::vector<int> calls;
+  bool added = false;
+
+  listeners.add([&]() {
+    calls.push_back(1);
+    if (!added) {
+      added = true;
+      listeners.add([&]() { calls.push_back(2); return false; });
+    }
+    return false;
+  });
+
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1});
+  REQUIRE(listeners.size() == 2);
+
+  calls.clear();
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1, 2});
+}
+
+TEST_CASE("Listeners added while called can be removed before they run", "[listeners]") {
+  SGI::Listeners<> listeners;
+  std::vector<int> calls;
+
+  listeners.add([&]() {
+    calls.push_back(1);
+    SGI::Listeners<>::Handle handle = listeners.add([&]() { calls.push_back(2); return false; });
+    REQUIRE(listeners.remove(handle));
+    return false;
+  });
+
+  listeners.call();
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1, 1});
+  REQUIRE(listeners.size() == 1);
+}
+
+TEST_CASE("Listeners can be cleared while they are called", "[listeners]") {
+  SGI::Listeners<> listeners;
+  std::vector<int> calls;
+
+  listeners.add([&]() { calls.push_back(1); listeners.clear(); return false; });
+  listeners.add([&]() { calls.push_back(2); return false; });
+
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1});
+  REQUIRE(listeners.empty());
+
+  listeners.call();
+  REQUIRE(calls == std::vector<int>{1});
+}
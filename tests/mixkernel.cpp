@@ -0,0 +1,90 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "mixkernel.h"
+
+TEST_CASE("Soft clip passes samples below the knee unchanged", "[audio]") {
+  std::vector<float> samples;
+  for (int i = -80; i <= 80; ++i) {
+    samples.push_back(i / 100.0f);
+  }
+
+  for (const std::string& name : SGI::MixKernel::getNames()) {
+    INFO(name);
+    REQUIRE(SGI::MixKernel::select(name));
+    std::vector<float> buffer = samples;
+    SGI::MixKernel::softClip(buffer.data(), static_cast<int>(buffer.size()));
+    CHECK(buffer == samples);
+  }
+  SGI::MixKernel::select(SGI::MixKernel::getNames().front());
+}
+
+TEST_CASE("Soft clip bends smoothly up to full scale", "[audio]") {
+  std::vector<float> samples;
+  for (int i = 0; i <= 400; ++i) {
+    samples.push_back(i / 200.0f);
+  }
+
+  for (const std::string& name : SGI::MixKernel::getNames()) {
+    INFO(name);
+    REQUIRE(SGI::MixKernel::select(name));
+    std::vector<float> buffer = samples;
+    SGI::MixKernel::softClip(buffer.data(), static_cast<int>(buffer.size()));
+
+    for (size_t i = 1; i < buffer.size(); ++i) {
+      CHECK(buffer[i] >= buffer[i - 1]);
+      CHECK(buffer[i] <= 1.0f);
+      // No steps, each input step of 0.005 moves the output at most as far
+      CHECK(buffer[i] - buffer[i - 1] <= 0.005f + 1e-6f);
+    }
+    CHECK(buffer[200] == Catch::Approx(0.95f));
+    CHECK(buffer[240] == 1.0f);
+    CHECK(buffer[400] == 1.0f);
+
+    std::vector<float> negative = {-0.5f, -1.0f, -3.0f};
+    SGI::MixKernel::softClip(negative.data(), static_cast<int>(negative.size()));
+    CHECK(negative[0] == -0.5f);
+    CHECK(negative[1] == Catch::Approx(-0.95f));
+    CHECK(negative[2] == -1.0f);
+  }
+  SGI::MixKernel::select(SGI::MixKernel::getNames().front());
+}
+
+TEST_CASE("Mix kernels match the scalar kernel", "[audio]") {
+  for (int frames : {0, 1, 3, 7, 64, 513}) {
+    std::vector<float> input(frames * 2);
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = std::sin(i * 0.1f);
+    }
+
+    REQUIRE(SGI::MixKernel::select("scalar"));
+    std::vector<float> expected(frames * 2, 0.25f);
+    SGI::MixKernel::mix(expected.data(), input.data(), frames, 0.5f, 1.0f, 0.001f, -0.001f);
+    std::vector<float> clipped = expected;
+    for (float& sample : clipped) {
+      sample *= 4.0f;
+    }
+    std::vector<float> expectedClipped = clipped;
+    SGI::MixKernel::softClip(expectedClipped.data(), static_cast<int>(expectedClipped.size()));
+
+    for (const std::string& name : SGI::MixKernel::getNames()) {
+      INFO(name << " with " << frames << " frames");
+      REQUIRE(SGI::MixKernel::select(name));
+
+      std::vector<float> output(frames * 2, 0.25f);
+      SGI::MixKernel::mix(output.data(), input.data(), frames, 0.5f, 1.0f, 0.001f, -0.001f);
+      for (size_t i = 0; i < output.size(); ++i) {
+        CHECK(output[i] == Catch::Approx(expected[i]).margin(1e-5));
+      }
+
+      std::vector<float> buffer = clipped;
+      SGI::MixKernel::softClip(buffer.data(), static_cast<int>(buffer.size()));
+      for (size_t i = 0; i < buffer.size(); ++i) {
+        CHECK(buffer[i] == Catch::Approx(expectedClipped[i]).margin(1e-6));
+      }
+    }
+  }
+  SGI::MixKernel::select(SGI::MixKernel::getNames().front());
+}
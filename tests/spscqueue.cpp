@@ -0,0 +1,77 @@
+#include <catch2/catch_all.hpp>
+#include <thread>
+
+#include "spscqueue.h"
+
+TEST_CASE("SpscQueue reports full and empty", "[spscqueue]") {
+  SGI::SpscQueue<int, 4> queue;
+  int value = 0;
+  REQUIRE_FALSE(queue.pop(value));
+
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(queue.push(i));
+  }
+  REQUIRE_FALSE(queue.push(4));
+
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == i);
+  }
+  REQUIRE_FALSE(queue.pop(value));
+}
+
+TEST_CASE("SpscQueue keeps its order when the positions wrap", "[spscqueue]") {
+  SGI::SpscQueue<int, 4> queue;
+  int next = 0;
+  int expected = 0;
+  int value = 0;
+
+  // Uneven pushes and pops move the start around the ring many times
+  for (int round = 0; round < 100; ++round) {
+    int pushes = 1 + round % 4;
+    for (int i = 0; i < pushes && queue.push(next); ++i) {
+      ++next;
+    }
+    int pops = 1 + (round * 3) % 4;
+    for (int i = 0; i < pops && queue.pop(value); ++i) {
+      REQUIRE(value == expected);
+      ++expected;
+    }
+  }
+
+  while (queue.pop(value)) {
+    REQUIRE(value == expected);
+    ++expected;
+  }
+  REQUIRE(expected == next);
+  REQUIRE(next > 4 * 20);
+}
+
+TEST_CASE("SpscQueue passes values between threads", "[spscqueue]") {
+  SGI::SpscQueue<int, 64> queue;
+  const int count = 100000;
+
+  std::thread producer([&]() {
+    for (int i = 0; i < count; ++i) {
+      while (!queue.push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 0;
+  int value = 0;
+  bool ordered = true;
+  while (expected < count) {
+    if (queue.pop(value)) {
+      ordered = ordered && value == expected;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  REQUIRE(ordered);
+  REQUIRE_FALSE(queue.pop(value));
+}